@@ -0,0 +1,93 @@
+#ifndef SDL_UTILS_BENCHMARK_BENCHMARKREPORT_H_
+#define SDL_UTILS_BENCHMARK_BENCHMARKREPORT_H_
+
+// System headers
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/** Collects benchmark results as flat JSON objects, so they can be consumed
+ *  by trend tracking tools.
+ * */
+class BenchmarkReport {
+ public:
+  class Entry {
+   public:
+    explicit Entry(const std::string &benchmarkName) {
+      add("benchmark", benchmarkName);
+    }
+
+    Entry &add(const std::string &key, const std::string &value) {
+      appendKey(key);
+      _ostr << '"' << value << '"';
+      return *this;
+    }
+
+    Entry &add(const std::string &key, const char *value) {
+      return add(key, std::string(value));
+    }
+
+    Entry &add(const std::string &key, const int64_t value) {
+      appendKey(key);
+      _ostr << value;
+      return *this;
+    }
+
+    Entry &add(const std::string &key, const uint64_t value) {
+      appendKey(key);
+      _ostr << value;
+      return *this;
+    }
+
+    Entry &add(const std::string &key, const uint32_t value) {
+      return add(key, static_cast<uint64_t>(value));
+    }
+
+    Entry &add(const std::string &key, const double value) {
+      appendKey(key);
+      _ostr << value;
+      return *this;
+    }
+
+    std::string str() const {
+      return "{" + _ostr.str() + "}";
+    }
+
+   private:
+    void appendKey(const std::string &key) {
+      if (!_isEmpty) {
+        _ostr << ", ";
+      }
+      _isEmpty = false;
+      _ostr << '"' << key << "\": ";
+    }
+
+    std::ostringstream _ostr;
+    bool _isEmpty = true;
+  };
+
+  void addEntry(const Entry &entry) {
+    _entries.push_back(entry.str());
+  }
+
+  void write(std::ostream &out) const {
+    out << "[\n";
+    for (size_t i = 0; i < _entries.size(); ++i) {
+      out << "  " << _entries[i] << ((i + 1 < _entries.size()) ? ",\n" : "\n");
+    }
+    out << "]\n";
+  }
+
+ private:
+  std::vector<std::string> _entries;
+};
+
+#endif /* SDL_UTILS_BENCHMARK_BENCHMARKREPORT_H_ */
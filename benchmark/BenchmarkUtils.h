@@ -0,0 +1,50 @@
+#ifndef SDL_UTILS_BENCHMARK_BENCHMARKUTILS_H_
+#define SDL_UTILS_BENCHMARK_BENCHMARKUTILS_H_
+
+// System headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+namespace BenchmarkUtils {
+
+inline int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** @brief busy waits for the provided duration (used to simulate work
+ *         without yielding the CPU)
+ * */
+inline void spinFor(const int64_t durationNs) {
+  const int64_t deadline = nowNs() + durationNs;
+  while (nowNs() < deadline) {
+  }
+}
+
+/** @brief sorts the samples in place and returns the requested percentile
+ *
+ *  @param std::vector<int64_t> & - samples
+ *  @param const double           - percentile in range [0, 100]
+ * */
+inline int64_t percentile(std::vector<int64_t> &samples, const double pct) {
+  if (samples.empty()) {
+    return 0;
+  }
+
+  const size_t idx = std::min(samples.size() - 1,
+      static_cast<size_t>((pct / 100.0) * static_cast<double>(samples.size())));
+  std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+  return samples[idx];
+}
+
+} // namespace BenchmarkUtils
+
+#endif /* SDL_UTILS_BENCHMARK_BENCHMARKUTILS_H_ */
@@ -0,0 +1,199 @@
+// Corresponding header
+#include "DrawParamsCodecBenchmark.h"
+
+// System headers
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/DrawParams.h"
+#include "sdl_utils/drawing/DrawParamsCodec.h"
+#include "utils/common/CircularBuffer.h"
+
+// Own components headers
+#include "BenchmarkReport.h"
+#include "BenchmarkUtils.h"
+
+namespace {
+constexpr uint32_t WIDGETS_COUNT = 10000;
+constexpr uint32_t FRAMES_COUNT = 200;
+
+enum class WidgetMix {
+  // mostly static images and texts, a few scaled/cropped/rotated ones
+  TYPICAL_UI,
+
+  // every widget is rotated, cropped, scaled and semi-transparent
+  WORST_CASE
+};
+
+const char *getMixName(const WidgetMix mix) {
+  return (WidgetMix::TYPICAL_UI == mix) ? "typical_ui" : "worst_case";
+}
+
+std::vector<DrawParams> generateWidgets(const WidgetMix mix) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int32_t> posDist(-200, 2100);
+  std::uniform_int_distribution<int32_t> sizeDist(8, 256);
+  std::uniform_int_distribution<int32_t> percentDist(0, 99);
+  std::uniform_int_distribution<uint64_t> rsrcDist(1, UINT64_MAX);
+
+  std::vector<DrawParams> widgets(WIDGETS_COUNT);
+  for (DrawParams &widget : widgets) {
+    const int32_t kind = percentDist(generator);
+    widget.widgetType = (kind < 70) ? WidgetType::IMAGE
+        : ((kind < 90) ? WidgetType::TEXT : WidgetType::SPRITE_BUFFER);
+    if (WidgetType::IMAGE == widget.widgetType) {
+      widget.rsrcId = rsrcDist(generator);
+    } else {
+      widget.spriteBufferId = percentDist(generator);
+    }
+
+    widget.pos = Point(posDist(generator), posDist(generator));
+    widget.frameRect = Rectangle(sizeDist(generator), sizeDist(generator),
+                                 sizeDist(generator), sizeDist(generator));
+
+    const bool isWorstCase = (WidgetMix::WORST_CASE == mix);
+    if (isWorstCase || (percentDist(generator) < 10)) {
+      widget.hasScaling = true;
+      widget.scaledWidth = sizeDist(generator);
+      widget.scaledHeight = sizeDist(generator);
+    }
+    if (isWorstCase || (percentDist(generator) < 5)) {
+      widget.hasCrop = true;
+      widget.frameCropRect = Rectangle(widget.pos, widget.frameRect.w / 2,
+                                       widget.frameRect.h / 2);
+    }
+    if (isWorstCase || (percentDist(generator) < 5)) {
+      widget.angle = percentDist(generator) * 3.6 + 0.1;
+      widget.rotCenter = Point(widget.frameRect.w / 2, widget.frameRect.h / 2);
+    }
+    if (isWorstCase || (percentDist(generator) < 10)) {
+      widget.opacity = percentDist(generator);
+    }
+  }
+
+  return widgets;
+}
+
+struct FrameSample {
+  int64_t writeNs = 0;
+  int64_t readNs = 0;
+  uint64_t bytes = 0;
+};
+
+FrameSample runRawFrame(const std::vector<DrawParams> &widgets,
+                        CircularBuffer &buffer,
+                        std::vector<DrawParams> &outWidgets) {
+  FrameSample sample;
+  sample.bytes = widgets.size() * sizeof(DrawParams);
+
+  const int64_t writeStartTs = BenchmarkUtils::nowNs();
+  buffer.write(reinterpret_cast<const uint8_t*>(widgets.data()), sample.bytes);
+  const int64_t readStartTs = BenchmarkUtils::nowNs();
+  buffer.read(reinterpret_cast<uint8_t*>(outWidgets.data()), sample.bytes);
+  const int64_t endTs = BenchmarkUtils::nowNs();
+
+  sample.writeNs = readStartTs - writeStartTs;
+  sample.readNs = endTs - readStartTs;
+  return sample;
+}
+
+FrameSample runPackedFrame(const std::vector<DrawParams> &widgets,
+                           CircularBuffer &buffer,
+                           std::vector<uint8_t> &scratch,
+                           std::vector<DrawParams> &outWidgets) {
+  FrameSample sample;
+  const uint32_t size = static_cast<uint32_t>(widgets.size());
+
+  const int64_t writeStartTs = BenchmarkUtils::nowNs();
+  sample.bytes =
+      DrawParamsCodec::encodeArray(widgets.data(), size, scratch.data());
+  buffer.write(scratch.data(), sample.bytes);
+  const int64_t readStartTs = BenchmarkUtils::nowNs();
+  buffer.read(scratch.data(), sample.bytes);
+  uint64_t parsedBytes = 0;
+  for (uint32_t i = 0; i < size; ++i) {
+    parsedBytes +=
+        DrawParamsCodec::decode(scratch.data() + parsedBytes, outWidgets[i]);
+  }
+  const int64_t endTs = BenchmarkUtils::nowNs();
+
+  sample.writeNs = readStartTs - writeStartTs;
+  sample.readNs = endTs - readStartTs;
+  return sample;
+}
+
+bool isDrawnIdentically(const DrawParams &lhs, const DrawParams &rhs) {
+  const bool isImage = (WidgetType::IMAGE == lhs.widgetType);
+  return (lhs.widgetType == rhs.widgetType) &&
+         (isImage ? (lhs.rsrcId == rhs.rsrcId)
+                  : (lhs.spriteBufferId == rhs.spriteBufferId)) &&
+         (lhs.hasCrop || (lhs.pos == rhs.pos)) &&
+         (lhs.frameRect == rhs.frameRect) &&
+         (lhs.hasScaling == rhs.hasScaling) &&
+         (!lhs.hasScaling || ((lhs.scaledWidth == rhs.scaledWidth) &&
+                              (lhs.scaledHeight == rhs.scaledHeight))) &&
+         (lhs.hasCrop == rhs.hasCrop) &&
+         (!lhs.hasCrop || (lhs.frameCropRect == rhs.frameCropRect)) &&
+         (lhs.angle == rhs.angle) &&
+         ((ZERO_ANGLE == lhs.angle) || (lhs.rotCenter == rhs.rotCenter)) &&
+         (lhs.opacity == rhs.opacity) &&
+         (lhs.widgetFlipType == rhs.widgetFlipType);
+}
+
+void runMix(const WidgetMix mix, const bool isPacked,
+            BenchmarkReport &report) {
+  const std::vector<DrawParams> widgets = generateWidgets(mix);
+  std::vector<DrawParams> outWidgets(widgets.size());
+  std::vector<uint8_t> scratch(
+      widgets.size() * DrawParamsCodec::MAX_ENCODED_SIZE);
+
+  CircularBuffer buffer;
+  buffer.init(widgets.size() * sizeof(DrawParams));
+
+  std::vector<int64_t> writeSamples(FRAMES_COUNT);
+  std::vector<int64_t> readSamples(FRAMES_COUNT);
+  uint64_t bytesPerFrame = 0;
+  for (uint32_t frame = 0; frame < FRAMES_COUNT; ++frame) {
+    const FrameSample sample = isPacked
+        ? runPackedFrame(widgets, buffer, scratch, outWidgets)
+        : runRawFrame(widgets, buffer, outWidgets);
+    writeSamples[frame] = sample.writeNs;
+    readSamples[frame] = sample.readNs;
+    bytesPerFrame = sample.bytes;
+  }
+
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < widgets.size(); ++i) {
+    if (!isDrawnIdentically(widgets[i], outWidgets[i])) {
+      ++mismatches;
+    }
+  }
+
+  const double writeNs =
+      static_cast<double>(BenchmarkUtils::percentile(writeSamples, 50.0));
+  const double readNs =
+      static_cast<double>(BenchmarkUtils::percentile(readSamples, 50.0));
+
+  BenchmarkReport::Entry entry("draw_params_codec");
+  entry.add("format", isPacked ? "packed" : "raw")
+       .add("widget_mix", getMixName(mix))
+       .add("widgets", WIDGETS_COUNT)
+       .add("bytes_per_frame", bytesPerFrame)
+       .add("bytes_per_widget",
+            static_cast<double>(bytesPerFrame) / WIDGETS_COUNT)
+       .add("write_ns_per_widget", writeNs / WIDGETS_COUNT)
+       .add("read_ns_per_widget", readNs / WIDGETS_COUNT)
+       .add("total_ns_per_widget", (writeNs + readNs) / WIDGETS_COUNT)
+       .add("mismatches", mismatches);
+  report.addEntry(entry);
+}
+}
+
+void runDrawParamsCodecBenchmark(BenchmarkReport &report) {
+  for (const WidgetMix mix : { WidgetMix::TYPICAL_UI, WidgetMix::WORST_CASE }) {
+    runMix(mix, false, report);
+    runMix(mix, true, report);
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef SDL_UTILS_BENCHMARK_DRAWPARAMSCODECBENCHMARK_H_
+#define SDL_UTILS_BENCHMARK_DRAWPARAMSCODECBENCHMARK_H_
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+class BenchmarkReport;
+
+/** @brief measures the bytes per frame and the ns per widget needed to
+ *         move 10k widgets through a CircularBuffer in the raw DrawParams
+ *         format and in the DrawParamsCodec packed format.
+ *
+ *         NOTE: no SDL calls are made.
+ * */
+void runDrawParamsCodecBenchmark(BenchmarkReport &report);
+
+#endif /* SDL_UTILS_BENCHMARK_DRAWPARAMSCODECBENCHMARK_H_ */
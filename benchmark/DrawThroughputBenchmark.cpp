@@ -0,0 +1,345 @@
+// Corresponding header
+#include "DrawThroughputBenchmark.h"
+
+// System headers
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Other libraries headers
+#include <SDL_hints.h>
+#include <SDL_surface.h>
+#include "sdl_utils/containers/SDLContainers.h"
+#include "sdl_utils/drawing/config/RendererConfig.h"
+#include "sdl_utils/drawing/DrawParams.h"
+#include "sdl_utils/drawing/MonitorWindow.h"
+#include "sdl_utils/drawing/Renderer.h"
+#include "sdl_utils/drawing/Texture.h"
+#include "sdl_utils/SDLLoader.h"
+#include "utils/data_type/EnumClassUtils.h"
+
+// Own components headers
+#include "BenchmarkReport.h"
+#include "BenchmarkUtils.h"
+
+namespace {
+constexpr int32_t WINDOW_WIDTH = 1280;
+constexpr int32_t WINDOW_HEIGHT = 720;
+
+constexpr uint32_t WIDGET_COUNTS[] { 100, 1000, 10000, 100000 };
+constexpr uint32_t MAX_WIDGETS = 100000;
+
+// frames per run = WIDGETS_BUDGET / widgets (clamped)
+constexpr uint64_t WIDGETS_BUDGET = 1000000;
+constexpr uint32_t MIN_FRAMES = 10;
+constexpr uint32_t MAX_FRAMES = 300;
+
+// fill the renderer pipeline before the measurement starts
+constexpr uint32_t WARMUP_FRAMES = MAX_RENDERER_PIPELINE_DEPTH;
+
+constexpr uint32_t IMAGE_TEXTURES_COUNT = 64;
+constexpr uint32_t TEXT_TEXTURES_COUNT = 16;
+constexpr uint64_t IMAGE_RSRC_ID_BASE = 1000;
+
+enum class WidgetMix {
+  PLAIN,
+  CROP,
+  SCALE,
+  ROTATION,
+
+  // a quarter of each of the above
+  MIXED
+};
+
+constexpr WidgetMix WIDGET_MIXES[] { WidgetMix::PLAIN, WidgetMix::CROP,
+    WidgetMix::SCALE, WidgetMix::ROTATION, WidgetMix::MIXED };
+
+const char *getMixName(const WidgetMix mix) {
+  switch (mix) {
+  case WidgetMix::PLAIN:
+    return "plain";
+  case WidgetMix::CROP:
+    return "crop";
+  case WidgetMix::SCALE:
+    return "scale";
+  case WidgetMix::ROTATION:
+    return "rotation";
+  default:
+    return "mixed";
+  }
+}
+
+class BenchmarkContainers : public SDLContainers {
+ public:
+  using SDLContainers::SDLContainers;
+
+  void onLoadTextureMultipleCompleted(
+      [[maybe_unused]]const int32_t batchId) override {
+  }
+};
+
+struct TextureSizes {
+  std::vector<Rectangle> images;
+  std::vector<Rectangle> texts;
+};
+
+/** @brief creates a texture with a solid background and a few bars,
+ *         so the software renderer has real pixels to blend
+ * */
+ErrorCode createSyntheticTexture(const int32_t width, const int32_t height,
+                                 const uint32_t seed, const bool isText,
+                                 SDL_Texture *&outTexture) {
+  SDL_Surface *surface = nullptr;
+  if (ErrorCode::SUCCESS !=
+      Texture::createEmptySurface(width, height, surface)) {
+    return ErrorCode::FAILURE;
+  }
+
+  const uint8_t shade = static_cast<uint8_t>(seed * 37);
+  const uint32_t background = isText
+      ? SDL_MapRGBA(surface->format, 0, 0, 0, 0)
+      : SDL_MapRGBA(surface->format, shade, 255 - shade, 128, 255);
+  const uint32_t foreground =
+      SDL_MapRGBA(surface->format, 255, 255, 255, 255);
+  SDL_FillRect(surface, nullptr, background);
+
+  // glyph like bars for the texts, stripes for the images
+  constexpr int32_t barWidth = 3;
+  constexpr int32_t barStep = 7;
+  for (int32_t x = 1; x + barWidth < width; x += barStep) {
+    const SDL_Rect bar { x, 2, barWidth, height - 4 };
+    SDL_FillRect(surface, &bar, foreground);
+  }
+
+  return Texture::loadTextureFromSurface(surface, outTexture);
+}
+
+ErrorCode populateContainers(BenchmarkContainers &containers,
+                             TextureSizes &outSizes) {
+  if (ErrorCode::SUCCESS !=
+      containers.TextContainer::init(nullptr, TEXT_TEXTURES_COUNT)) {
+    return ErrorCode::FAILURE;
+  }
+
+  for (uint32_t i = 0; i < IMAGE_TEXTURES_COUNT; ++i) {
+    const int32_t size = 16 + static_cast<int32_t>((i * 7) % 49);
+    SDL_Texture *texture = nullptr;
+    if (ErrorCode::SUCCESS !=
+        createSyntheticTexture(size, size, i, false, texture)) {
+      return ErrorCode::FAILURE;
+    }
+    containers.attachRsrcTexture(IMAGE_RSRC_ID_BASE + i, size, size, texture);
+    outSizes.images.emplace_back(0, 0, size, size);
+  }
+
+  for (uint32_t i = 0; i < TEXT_TEXTURES_COUNT; ++i) {
+    const int32_t width = 60 + static_cast<int32_t>(i * 10);
+    constexpr int32_t height = 20;
+    SDL_Texture *texture = nullptr;
+    if (ErrorCode::SUCCESS !=
+        createSyntheticTexture(width, height, i, true, texture)) {
+      return ErrorCode::FAILURE;
+    }
+    containers.attachText(static_cast<int32_t>(i), width, height, texture);
+    outSizes.texts.emplace_back(0, 0, width, height);
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+std::vector<DrawParams> generateWidgets(const uint32_t count,
+                                        const WidgetMix mix,
+                                        const TextureSizes &sizes) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int32_t> xDist(-32, WINDOW_WIDTH);
+  std::uniform_int_distribution<int32_t> yDist(-32, WINDOW_HEIGHT);
+  std::uniform_int_distribution<uint32_t> imageDist(
+      0, IMAGE_TEXTURES_COUNT - 1);
+  std::uniform_int_distribution<uint32_t> textDist(0, TEXT_TEXTURES_COUNT - 1);
+  std::uniform_int_distribution<int32_t> percentDist(0, 99);
+
+  std::vector<DrawParams> widgets(count);
+  for (DrawParams &widget : widgets) {
+    const bool isImage = (75 > percentDist(generator));
+    if (isImage) {
+      const uint32_t imageIdx = imageDist(generator);
+      widget.widgetType = WidgetType::IMAGE;
+      widget.rsrcId = IMAGE_RSRC_ID_BASE + imageIdx;
+      widget.frameRect = sizes.images[imageIdx];
+    } else {
+      const uint32_t textIdx = textDist(generator);
+      widget.widgetType = WidgetType::TEXT;
+      widget.textId = static_cast<int32_t>(textIdx);
+      widget.frameRect = sizes.texts[textIdx];
+    }
+    widget.pos = Point(xDist(generator), yDist(generator));
+
+    WidgetMix widgetMix = mix;
+    if (WidgetMix::MIXED == mix) {
+      widgetMix = WIDGET_MIXES[percentDist(generator) % 4];
+    }
+
+    const int32_t width = widget.frameRect.w;
+    const int32_t height = widget.frameRect.h;
+    switch (widgetMix) {
+    case WidgetMix::CROP:
+      widget.hasCrop = true;
+      widget.frameRect = Rectangle(2, 2, width - 4, height - 4);
+      widget.frameCropRect = Rectangle(widget.pos.x + 2, widget.pos.y + 2,
+                                       width - 4, height - 4);
+      break;
+
+    case WidgetMix::SCALE:
+      widget.hasScaling = true;
+      widget.scaledWidth = (width * 3) / 2;
+      widget.scaledHeight = (height * 3) / 2;
+      break;
+
+    case WidgetMix::ROTATION:
+      widget.angle = percentDist(generator) * 3.6 + 0.5;
+      widget.rotCenter = Point(width / 2, height / 2);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  return widgets;
+}
+
+struct RunResult {
+  int64_t wallNs = 0;
+  int64_t utWaitNs = 0;
+};
+
+void runFrame(Renderer &renderer, const std::vector<DrawParams> &widgets,
+              RunResult &result) {
+  renderer.clearScreen_UT();
+  for (const DrawParams &widget : widgets) {
+    renderer.addDrawCmd_UT(widget);
+  }
+
+  // SINGLE_THREADED - the frame is executed here
+  // MULTI_THREADED  - waits for a free renderer state
+  const int64_t finishStartTs = BenchmarkUtils::nowNs();
+  renderer.finishFrame_UT(false);
+  result.utWaitNs += BenchmarkUtils::nowNs() - finishStartTs;
+}
+
+void sweep(Renderer &renderer, const RendererPolicy policy,
+           const TextureSizes &sizes, BenchmarkReport &report) {
+  for (const uint32_t widgetsCount : WIDGET_COUNTS) {
+    const uint32_t framesCount = static_cast<uint32_t>(std::clamp<uint64_t>(
+        WIDGETS_BUDGET / widgetsCount, MIN_FRAMES, MAX_FRAMES));
+
+    for (const WidgetMix mix : WIDGET_MIXES) {
+      const std::vector<DrawParams> widgets =
+          generateWidgets(widgetsCount, mix, sizes);
+
+      RunResult warmup;
+      for (uint32_t frame = 0; frame < WARMUP_FRAMES; ++frame) {
+        runFrame(renderer, widgets, warmup);
+      }
+
+      RunResult result;
+      const int64_t startTs = BenchmarkUtils::nowNs();
+      for (uint32_t frame = 0; frame < framesCount; ++frame) {
+        runFrame(renderer, widgets, result);
+      }
+      result.wallNs = BenchmarkUtils::nowNs() - startTs;
+
+      const double wallNs = static_cast<double>(result.wallNs);
+      BenchmarkReport::Entry entry("draw_throughput");
+      entry.add("policy", getRendererPolicyName(policy))
+           .add("widget_mix", getMixName(mix))
+           .add("widgets", widgetsCount)
+           .add("frames", framesCount)
+           .add("fps", (framesCount * 1e9) / wallNs)
+           .add("ns_per_widget",
+                wallNs / (static_cast<double>(framesCount) * widgetsCount))
+           .add("ut_wait_ns_per_frame",
+                static_cast<double>(result.utWaitNs) / framesCount)
+           .add("ut_wait_pct", (100.0 * result.utWaitNs) / wallNs);
+      report.addEntry(entry);
+    }
+  }
+}
+
+void runPolicy(const RendererPolicy policy, BenchmarkReport &report) {
+  MonitorWindowConfig windowCfg;
+  windowCfg.name = "sdl_utils_bench";
+  windowCfg.pos = Points::UNDEFINED;
+  windowCfg.width = WINDOW_WIDTH;
+  windowCfg.height = WINDOW_HEIGHT;
+  windowCfg.displayMode = WindowDisplayMode::WINDOWED;
+  windowCfg.borderMode = WindowBorderMode::BORDERLESS;
+
+  MonitorWindow window;
+  if (ErrorCode::SUCCESS != window.init(windowCfg)) {
+    std::cerr << "Error, window.init() failed" << std::endl;
+    return;
+  }
+
+  RendererConfig rendererCfg;
+  rendererCfg.window = window.getNativeWindow();
+  rendererCfg.executionPolicy = policy;
+  rendererCfg.flagsMask = getEnumValue(RendererFlag::SOFTARE_RENDERER) |
+                          getEnumValue(RendererFlag::FBO_ENABLE);
+  rendererCfg.maxRuntimeWidgets = MAX_WIDGETS;
+  rendererCfg.maxRuntimeRendererCommands = 16;
+  rendererCfg.maxRendererBackBufferDataSize = 1024;
+
+  Renderer renderer;
+  if (ErrorCode::SUCCESS != renderer.init(rendererCfg)) {
+    std::cerr << "Error, renderer.init() failed" << std::endl;
+    return;
+  }
+
+  BenchmarkContainers containers { SDLContainersConfig() };
+  containers.setRenderer(&renderer);
+  renderer.setSDLContainers(&containers);
+
+  TextureSizes sizes;
+  if (ErrorCode::SUCCESS != populateContainers(containers, sizes)) {
+    std::cerr << "Error, synthetic textures creation failed" << std::endl;
+    containers.ResourceContainer::deinit();
+    containers.TextContainer::deinit();
+    renderer.deinit();
+    return;
+  }
+
+  if (RendererPolicy::SINGLE_THREADED == policy) {
+    sweep(renderer, policy, sizes, report);
+    renderer.shutdownRenderer_UT();
+  } else {
+    // the renderer thread must be the one, which created the SDL_Renderer
+    std::thread updateThread([&]() {
+      sweep(renderer, policy, sizes, report);
+      renderer.shutdownRenderer_UT();
+    });
+    renderer.executeRenderCommands_RT();
+    updateThread.join();
+  }
+
+  containers.ResourceContainer::deinit();
+  containers.TextContainer::deinit();
+  renderer.deinit();
+}
+}
+
+void runDrawThroughputBenchmark(BenchmarkReport &report) {
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  if (ErrorCode::SUCCESS != SDLLoader::initSdl2()) {
+    std::cerr << "Error, SDLLoader::initSdl2() failed" << std::endl;
+    return;
+  }
+
+  runPolicy(RendererPolicy::SINGLE_THREADED, report);
+  runPolicy(RendererPolicy::MULTI_THREADED, report);
+
+  SDLLoader::deinitSdl2();
+}
@@ -0,0 +1,24 @@
+#ifndef SDL_UTILS_BENCHMARK_DRAWTHROUGHPUTBENCHMARK_H_
+#define SDL_UTILS_BENCHMARK_DRAWTHROUGHPUTBENCHMARK_H_
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+class BenchmarkReport;
+
+/** @brief measures frames per second, ns per widget and the update thread
+ *         wait time of the whole Renderer for 100 to 100k widgets with
+ *         plain, cropped, scaled, rotated and mixed widgets for both
+ *         RendererPolicy::SINGLE_THREADED and MULTI_THREADED.
+ *
+ *         NOTE: runs headless - the SDL dummy video driver and the
+ *               software renderer are used. The image and text textures
+ *               are synthetic, so no resources are needed.
+ * */
+void runDrawThroughputBenchmark(BenchmarkReport &report);
+
+#endif /* SDL_UTILS_BENCHMARK_DRAWTHROUGHPUTBENCHMARK_H_ */
@@ -0,0 +1,168 @@
+// Corresponding header
+#include "FrameHandoffBenchmark.h"
+
+// System headers
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/FrameHandoff.h"
+
+// Own components headers
+#include "BenchmarkReport.h"
+#include "BenchmarkUtils.h"
+
+namespace {
+constexpr uint32_t FRAMES_COUNT = 20000;
+
+struct HandoffScenario {
+  const char *name;
+  int64_t updateWorkNs;
+  int64_t renderWorkNs;
+};
+
+constexpr HandoffScenario SCENARIOS[] = {
+  { "no_work", 0, 0 },
+  { "render_bound", 20000, 60000 },
+  { "update_bound", 60000, 20000 },
+  { "balanced", 40000, 40000 },
+
+  //every 16th frame the renderer thread stalls for 500us
+  { "render_hiccups", 40000, 30000 }
+};
+
+constexpr uint32_t HICCUP_PERIOD = 16;
+constexpr int64_t HICCUP_NS = 500000;
+
+struct HandoffConfig {
+  FrameHandoffPolicy policy;
+  FramePresentMode presentMode;
+  uint32_t pipelineDepth;
+};
+
+const char *getPolicyName(const FrameHandoffPolicy policy) {
+  return (FrameHandoffPolicy::LOCK_FREE == policy) ? "LOCK_FREE"
+                                                   : "CONDITION_VARIABLE";
+}
+
+const char *getPresentModeName(const FramePresentMode mode) {
+  return (FramePresentMode::MAILBOX == mode) ? "MAILBOX" : "FIFO";
+}
+
+void runScenario(const HandoffConfig &cfg, const HandoffScenario &scenario,
+                 BenchmarkReport &report) {
+  FrameHandoff handoff;
+  handoff.init(cfg.policy, cfg.pipelineDepth);
+
+  const bool hasHiccups = (0 == std::strcmp(scenario.name, "render_hiccups"));
+
+  // per slot data. Ordered by the frame handoff itself
+  std::vector<int64_t> slotPublishTs(cfg.pipelineDepth, 0);
+  std::vector<uint8_t> slotIsLast(cfg.pipelineDepth, 0);
+
+  std::vector<int64_t> handoffLatencies;
+  handoffLatencies.reserve(FRAMES_COUNT);
+  std::vector<int64_t> updateWaits(FRAMES_COUNT, 0);
+  std::vector<uint32_t> queueDepths(FRAMES_COUNT, 0);
+  uint32_t replacedFrames = 0;
+
+  const int64_t startTs = BenchmarkUtils::nowNs();
+
+  std::thread renderThread([&]() {
+    for (uint32_t frame = 0; ; ++frame) {
+      const uint32_t slot = handoff.waitForFrame_RT();
+      handoffLatencies.push_back(BenchmarkUtils::nowNs() - slotPublishTs[slot]);
+      if (slotIsLast[slot]) {
+        handoff.releaseFrame_RT();
+        return;
+      }
+
+      const bool isHiccup = hasHiccups && (0 == (frame % HICCUP_PERIOD));
+      BenchmarkUtils::spinFor(isHiccup ? HICCUP_NS : scenario.renderWorkNs);
+      handoff.releaseFrame_RT();
+    }
+  });
+
+  for (uint32_t frame = 0; frame < FRAMES_COUNT; ++frame) {
+    BenchmarkUtils::spinFor(scenario.updateWorkNs);
+
+    const int64_t waitStartTs = BenchmarkUtils::nowNs();
+    const bool isReplaced = (FramePresentMode::MAILBOX == cfg.presentMode) &&
+        !handoff.hasFreeSlot_UT() && handoff.replacePendingFrame_UT();
+    if (isReplaced) {
+      ++replacedFrames;
+    } else {
+      handoff.waitForFreeSlot_UT();
+    }
+    const int64_t waitEndTs = BenchmarkUtils::nowNs();
+    updateWaits[frame] = waitEndTs - waitStartTs;
+
+    const uint32_t slot = handoff.getUpdateSlot_UT();
+    slotPublishTs[slot] = waitEndTs;
+    slotIsLast[slot] = (FRAMES_COUNT - 1 == frame) ? 1 : 0;
+    handoff.publishFrame_UT();
+    queueDepths[frame] = handoff.getFramesInFlight();
+  }
+
+  renderThread.join();
+  const int64_t elapsedNs = BenchmarkUtils::nowNs() - startTs;
+
+  int64_t totalUpdateWaitNs = 0;
+  for (const int64_t wait : updateWaits) {
+    totalUpdateWaitNs += wait;
+  }
+  uint64_t totalQueueDepth = 0;
+  for (const uint32_t depth : queueDepths) {
+    totalQueueDepth += depth;
+  }
+
+  BenchmarkReport::Entry entry("frame_handoff");
+  entry.add("policy", getPolicyName(cfg.policy))
+       .add("present_mode", getPresentModeName(cfg.presentMode))
+       .add("pipeline_depth", cfg.pipelineDepth)
+       .add("scenario", scenario.name)
+       .add("frames", FRAMES_COUNT)
+       .add("replaced_frames", replacedFrames)
+       .add("update_frames_per_sec",
+            (FRAMES_COUNT * 1e9) / static_cast<double>(elapsedNs))
+       .add("handoff_latency_p50_ns",
+            BenchmarkUtils::percentile(handoffLatencies, 50.0))
+       .add("handoff_latency_p99_ns",
+            BenchmarkUtils::percentile(handoffLatencies, 99.0))
+       .add("handoff_latency_max_ns",
+            BenchmarkUtils::percentile(handoffLatencies, 100.0))
+       .add("update_wait_avg_ns", totalUpdateWaitNs / FRAMES_COUNT)
+       .add("update_wait_p99_ns",
+            BenchmarkUtils::percentile(updateWaits, 99.0))
+       .add("queue_depth_avg",
+            static_cast<double>(totalQueueDepth) / FRAMES_COUNT);
+  report.addEntry(entry);
+}
+}
+
+void runFrameHandoffBenchmark(BenchmarkReport &report) {
+  constexpr FrameHandoffPolicy policies[] = {
+    FrameHandoffPolicy::CONDITION_VARIABLE, FrameHandoffPolicy::LOCK_FREE
+  };
+  constexpr FramePresentMode presentModes[] = {
+    FramePresentMode::FIFO, FramePresentMode::MAILBOX
+  };
+
+  for (const auto &scenario : SCENARIOS) {
+    for (const FrameHandoffPolicy policy : policies) {
+      for (uint32_t depth = MIN_RENDERER_PIPELINE_DEPTH;
+           depth <= MAX_RENDERER_PIPELINE_DEPTH; ++depth) {
+        for (const FramePresentMode presentMode : presentModes) {
+          // replacing is not possible with the minimal pipeline depth
+          if ((FramePresentMode::MAILBOX == presentMode) &&
+              (MIN_RENDERER_PIPELINE_DEPTH == depth)) {
+            continue;
+          }
+          runScenario({ policy, presentMode, depth }, scenario, report);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,23 @@
+#ifndef SDL_UTILS_BENCHMARK_FRAMEHANDOFFBENCHMARK_H_
+#define SDL_UTILS_BENCHMARK_FRAMEHANDOFFBENCHMARK_H_
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+class BenchmarkReport;
+
+/** @brief measures the update thread --> renderer thread frame handoff
+ *         latency, the update thread wait time and the queue depth for every
+ *         FrameHandoffPolicy, pipeline depth and FramePresentMode under
+ *         render bound, update bound and render hiccups workloads.
+ *
+ *         NOTE: no SDL calls are made. The frame work is simulated with
+ *               busy waiting.
+ * */
+void runFrameHandoffBenchmark(BenchmarkReport &report);
+
+#endif /* SDL_UTILS_BENCHMARK_FRAMEHANDOFFBENCHMARK_H_ */
@@ -0,0 +1,165 @@
+// Corresponding header
+#include "TiledRasterBenchmark.h"
+
+// System headers
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/DrawParams.h"
+#include "sdl_utils/drawing/FrameWidgets.h"
+#include "sdl_utils/drawing/TiledRasterizer.h"
+
+// Own components headers
+#include "BenchmarkReport.h"
+#include "BenchmarkUtils.h"
+
+namespace {
+constexpr int32_t TARGET_WIDTH = 1920;
+constexpr int32_t TARGET_HEIGHT = 1080;
+
+constexpr uint32_t WIDGET_COUNTS[] { 100, 1000, 10000 };
+constexpr uint32_t FRAMES_COUNT = 30;
+constexpr uint32_t WARMUP_FRAMES = 3;
+
+constexpr uint32_t TEXTURES_COUNT = 16;
+constexpr int32_t TEXTURE_SIZE = 128;
+
+struct SyntheticTexture {
+  std::vector<uint32_t> pixels;
+  BlendMode blendMode = BlendMode::BLEND;
+};
+
+std::vector<SyntheticTexture> generateTextures() {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<uint32_t> colorDist(0, UINT32_MAX);
+
+  std::vector<SyntheticTexture> textures(TEXTURES_COUNT);
+  for (uint32_t i = 0; i < TEXTURES_COUNT; ++i) {
+    SyntheticTexture &texture = textures[i];
+    texture.pixels.resize(TEXTURE_SIZE * TEXTURE_SIZE);
+    for (uint32_t &pixel : texture.pixels) {
+      pixel = colorDist(generator);
+    }
+
+    // a quarter of the textures are opaque backgrounds
+    if (0 == (i % 4)) {
+      texture.blendMode = BlendMode::NONE;
+    }
+  }
+
+  return textures;
+}
+
+void generateWidgets(const uint32_t widgetsCount,
+                     const std::vector<SyntheticTexture> &textures,
+                     FrameWidgets &outWidgets,
+                     std::vector<RasterSource> &outSources) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int32_t> posXDist(-64, TARGET_WIDTH);
+  std::uniform_int_distribution<int32_t> posYDist(-64, TARGET_HEIGHT);
+  std::uniform_int_distribution<int32_t> sizeDist(16, TEXTURE_SIZE);
+  std::uniform_int_distribution<int32_t> percentDist(0, 99);
+  std::uniform_int_distribution<uint32_t> textureDist(0, TEXTURES_COUNT - 1);
+
+  outWidgets.init(widgetsCount);
+  outSources.resize(widgetsCount);
+  for (uint32_t i = 0; i < widgetsCount; ++i) {
+    DrawParams widget;
+    widget.pos = Point(posXDist(generator), posYDist(generator));
+    widget.frameRect = Rectangle(0, 0, sizeDist(generator),
+                                 sizeDist(generator));
+    if (percentDist(generator) < 25) {
+      widget.hasScaling = true;
+      widget.scaledWidth = sizeDist(generator) * 2;
+      widget.scaledHeight = sizeDist(generator) * 2;
+    }
+    if (percentDist(generator) < 10) {
+      widget.widgetFlipType = WidgetFlipType::VERTICAL_AND_HORIZONTAL;
+    }
+    if (percentDist(generator) < 20) {
+      widget.opacity = percentDist(generator);
+    }
+    outWidgets.setDrawParams(i, widget);
+
+    const SyntheticTexture &texture = textures[textureDist(generator)];
+    RasterSource &source = outSources[i];
+    source.pixels = texture.pixels.data();
+    source.width = TEXTURE_SIZE;
+    source.height = TEXTURE_SIZE;
+    source.pitch = TEXTURE_SIZE;
+    source.alphaMod = static_cast<uint8_t>(widget.opacity);
+    source.blendMode = texture.blendMode;
+  }
+}
+
+void runWidgetsCount(const uint32_t widgetsCount,
+                     const std::vector<SyntheticTexture> &textures,
+                     BenchmarkReport &report) {
+  FrameWidgets widgets;
+  std::vector<RasterSource> sources;
+  generateWidgets(widgetsCount, textures, widgets, sources);
+
+  const RasterSurface target { nullptr, TARGET_WIDTH, TARGET_HEIGHT,
+                               TARGET_WIDTH };
+  std::vector<uint32_t> referencePixels;
+  std::vector<uint32_t> pixels(
+      static_cast<size_t>(TARGET_WIDTH) * TARGET_HEIGHT);
+  constexpr uint32_t clearColor = 0xFF000000u;
+
+  const uint32_t maxThreads =
+      std::max(std::thread::hardware_concurrency(), 1u);
+  double singleThreadNs = 0.0;
+  for (uint32_t threads = 1; threads <= maxThreads; ++threads) {
+    TiledRasterizer rasterizer;
+    rasterizer.init(threads, TiledRasterizer::DEFAULT_TILE_SIZE);
+
+    RasterSurface frameTarget = target;
+    frameTarget.pixels = pixels.data();
+    for (uint32_t i = 0; i < WARMUP_FRAMES; ++i) {
+      rasterizer.rasterize(widgets, widgetsCount, sources.data(), clearColor,
+                           frameTarget);
+    }
+
+    std::vector<int64_t> samples(FRAMES_COUNT);
+    for (uint32_t i = 0; i < FRAMES_COUNT; ++i) {
+      const int64_t startTs = BenchmarkUtils::nowNs();
+      rasterizer.rasterize(widgets, widgetsCount, sources.data(), clearColor,
+                           frameTarget);
+      samples[i] = BenchmarkUtils::nowNs() - startTs;
+    }
+    rasterizer.deinit();
+
+    if (1 == threads) {
+      referencePixels = pixels;
+    }
+    const bool isBitExact = (referencePixels == pixels);
+
+    const double frameNs =
+        static_cast<double>(BenchmarkUtils::percentile(samples, 50.0));
+    if (1 == threads) {
+      singleThreadNs = frameNs;
+    }
+
+    BenchmarkReport::Entry entry("tiled_raster");
+    entry.add("widgets", widgetsCount)
+         .add("threads", threads)
+         .add("ns_per_frame", frameNs)
+         .add("p99_ns_per_frame",
+              static_cast<double>(BenchmarkUtils::percentile(samples, 99.0)))
+         .add("speedup", singleThreadNs / frameNs)
+         .add("bit_exact", isBitExact ? "true" : "false");
+    report.addEntry(entry);
+  }
+}
+}
+
+void runTiledRasterBenchmark(BenchmarkReport &report) {
+  const std::vector<SyntheticTexture> textures = generateTextures();
+  for (const uint32_t widgetsCount : WIDGET_COUNTS) {
+    runWidgetsCount(widgetsCount, textures, report);
+  }
+}
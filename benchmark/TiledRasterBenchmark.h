@@ -0,0 +1,22 @@
+#ifndef SDL_UTILS_BENCHMARK_TILEDRASTERBENCHMARK_H_
+#define SDL_UTILS_BENCHMARK_TILEDRASTERBENCHMARK_H_
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+class BenchmarkReport;
+
+/** @brief measures the ns per frame of the TiledRasterizer for 1 to
+ *         hardware concurrency threads with plain, scaled, flipped and
+ *         translucent widgets. The output of every run is compared with
+ *         the single thread one.
+ *
+ *         NOTE: no SDL calls are made. The textures are synthetic.
+ * */
+void runTiledRasterBenchmark(BenchmarkReport &report);
+
+#endif /* SDL_UTILS_BENCHMARK_TILEDRASTERBENCHMARK_H_ */
@@ -0,0 +1,81 @@
+// System headers
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+#include "BenchmarkReport.h"
+#include "DrawParamsCodecBenchmark.h"
+#include "DrawThroughputBenchmark.h"
+#include "FrameHandoffBenchmark.h"
+#include "TiledRasterBenchmark.h"
+
+namespace {
+struct BenchmarkSuite {
+  const char *name;
+  std::function<void(BenchmarkReport &)> run;
+};
+
+const std::vector<BenchmarkSuite> SUITES {
+  { "frame_handoff", runFrameHandoffBenchmark },
+  { "draw_params_codec", runDrawParamsCodecBenchmark },
+  { "draw_throughput", runDrawThroughputBenchmark },
+  { "tiled_raster", runTiledRasterBenchmark }
+};
+
+void printUsage(const char *binaryName) {
+  std::cerr << "Usage: " << binaryName
+            << " [--suite <name>]... [--output <file.json>]\nSuites:\n";
+  for (const auto &suite : SUITES) {
+    std::cerr << '\t' << suite.name << '\n';
+  }
+}
+}
+
+int main(int argc, char *argv[]) {
+  std::vector<std::string> selectedSuites;
+  std::string outputFile;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((0 == std::strcmp(argv[i], "--suite")) && (i + 1 < argc)) {
+      selectedSuites.emplace_back(argv[++i]);
+    } else if ((0 == std::strcmp(argv[i], "--output")) && (i + 1 < argc)) {
+      outputFile = argv[++i];
+    } else {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  BenchmarkReport report;
+  for (const auto &suite : SUITES) {
+    const bool isSelected = selectedSuites.empty() ||
+        (std::find(selectedSuites.begin(), selectedSuites.end(), suite.name) !=
+         selectedSuites.end());
+    if (isSelected) {
+      std::cerr << "Running [" << suite.name << "] ..." << std::endl;
+      suite.run(report);
+    }
+  }
+
+  if (outputFile.empty()) {
+    report.write(std::cout);
+    return EXIT_SUCCESS;
+  }
+
+  std::ofstream ofstr(outputFile);
+  if (!ofstr) {
+    std::cerr << "Error, could not open [" << outputFile << "]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  report.write(ofstr);
+
+  return EXIT_SUCCESS;
+}
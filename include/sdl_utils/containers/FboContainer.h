@@ -9,6 +9,7 @@
 #include "utils/ErrorCode.h"
 
 // Own components headers
+#include "sdl_utils/containers/SlotAllocator.h"
 #include "sdl_utils/drawing/defines/RendererDefines.h"
 
 // Forward declarations
@@ -95,6 +96,15 @@ class FboContainer {
    * */
    uint64_t getGPUMemoryUsage() const { return _gpuMemoryUsage; }
 
+  /** @brief used to acquire the occupancy statistics of the fbo slots
+   *         NOTE: O(maxRuntimeSpriteBuffers) - intended for diagnostics only
+   *
+   *  @return SlotAllocatorStats - fbo slots statistics
+   * */
+  SlotAllocatorStats getFboSlotStats() const {
+    return _fboSlots.getStats();
+  }
+
  private:
   // holds pointer to hardware render in order
   // to be able to push RendererCmd's
@@ -109,14 +119,19 @@ class FboContainer {
    *
    * NOTE: do NOT resize the vector. This will crash the program
    *
-   * NOTE2: When text is deleted - do not remove it from the structure.
-   *        Instead - simply leave the vector element with nullptr value.
-   *        When new text is added - simply linearly scan the array and
-   *        search for a free position (nullptr value).
+   * NOTE2: The vectors are indexed by SlotAllocator::getIndex(fboId).
+   *        When fbo is deleted - its slot is returned to _fboSlots
+   *        and the vector element is left with nullptr value.
    **/
-  //_textsVec holds all Texts
   std::vector<SDL_Texture*> _textures;
 
+  // holds the generation tagged id of the attached fbo for every slot.
+  // Used by the renderer thread to reject stale fbo ids
+  std::vector<int32_t> _fboIds;
+
+  // hands out the fbo ids. Accessed only by the update thread
+  SlotAllocator _fboSlots;
+
   // holds holds many bytes the current text occupied in GPU VRAM
   std::vector<uint64_t> _fboMemoryUsage;
 
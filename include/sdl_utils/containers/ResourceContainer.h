@@ -12,6 +12,8 @@
 #include "utils/ErrorCode.h"
 
 // Own components headers
+#include "sdl_utils/containers/SurfaceLoadBatch.h"
+#include "sdl_utils/drawing/defines/DrawConstants.h"
 #include "sdl_utils/drawing/defines/RendererDefines.h"
 
 // Forward declarations
@@ -24,6 +26,15 @@ class Renderer;
 struct SDL_Surface;
 struct SDL_Texture;
 
+// a resource, dispatched to the worker threads for decoding
+struct SurfaceLoadJob {
+  ResourceData rsrcData;
+
+  // completion slot of the on demand load request.
+  // nullptr for the resources, loaded on init
+  SurfaceLoadBatch *batch = nullptr;
+};
+
 class ResourceContainer {
  public:
   ResourceContainer();
@@ -56,7 +67,13 @@ class ResourceContainer {
     _renderer = renderer;
   }
 
-  /** @brief used to store the provided ResourceData in Resource Container
+  /** @brief used to store the provided ResourceData in Resource Container.
+   *         A dense texture slot is registered for the resource.
+   *
+   *         NOTE: the texture slots are read by the renderer thread.
+   *               Register the resources before the rendering starts
+   *               or stay within the static + dynamic widgets count,
+   *               provided to ::init().
    *
    *  @param ResourceData & - populated structure with
    *                                               Resource specific data
@@ -191,6 +208,41 @@ class ResourceContainer {
    * */
   void getRsrcTexture(const uint64_t rsrcId, SDL_Texture *&outTexture);
 
+  /** @brief used to resolve a registered resource to a dense handle.
+   *         The handle stays valid for the lifetime of the container
+   *         (including texture unload/reload), so it could be resolved
+   *         once and stored in DrawParams::rsrcHandle.
+   *
+   *  @param const uint64_t - unique resource ID
+   *
+   *  @return RsrcHandle    - the handle or INVALID_RSRC_HANDLE
+   * */
+  RsrcHandle getRsrcHandle(const uint64_t rsrcId) const;
+
+  /** @brief used to acquire previously stored pre-created SDL_Texture
+   *         for a valid (not INVALID_RSRC_HANDLE) handle.
+   *         Bounds checked array index. Debug builds also detect handles
+   *         of other containers and handles, not matching the rsrcId.
+   *  This function does not return error code for performance reasons
+   *
+   *  @param const RsrcHandle - handle from ::getRsrcHandle()
+   *  @param const uint64_t   - unique resource ID, the handle is for
+   *  @param SDL_Texture *&   - pre-created SDL_Texture
+   * */
+  void getRsrcTexture(const RsrcHandle rsrcHandle, const uint64_t rsrcId,
+                      SDL_Texture *&outTexture) const {
+#ifndef NDEBUG
+    if (!isValidRsrcHandle(rsrcHandle, rsrcId)) {
+      return;
+    }
+#endif //!NDEBUG
+
+    const uint32_t slotIdx = rsrcHandle & RSRC_HANDLE_INDEX_MASK;
+    if (slotIdx < _rsrcTextures.size()) {
+      outTexture = _rsrcTextures[slotIdx];
+    }
+  }
+
   /** @brief used to detach(free the slot in the container) for
    *         successfully destroyed SDL_Surface/SDL_Texture by the
    *                              renderer and decrease the used GPU VRAM
@@ -209,15 +261,14 @@ class ResourceContainer {
    * */
   ErrorCode loadSurface(const uint64_t rsrcId, SDL_Surface *&outSurface);
 
-  /** @brief uses to expose the stored surfaces/into a thread safe queue/
-   *         to the renderer API.
+  /** @brief used to return the batch of an on demand load request,
+   *         after the renderer consumed all of its surfaces.
    *
    *         WARNING: do not invoke this method outside of
    *                  the Renderer API!!!
    * */
-   ThreadSafeQueue<std::pair<uint64_t, SDL_Surface *>>
-      *getLoadedSurfacesQueue() const {
-    return _loadedSurfacesThreadQueue;
+  void releaseSurfaceLoadBatch(SurfaceLoadBatch *batch) {
+    _surfaceLoadBatchPool.release(batch);
   }
 
   /** @brief used to acquire the occupied GPU VRAM from
@@ -246,6 +297,27 @@ class ResourceContainer {
   virtual void onLoadTextureMultipleCompleted(const int32_t batchId) = 0;
 
  private:
+  /** @brief registers a dense texture slot for the resource
+   *         (if not already registered)
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void registerRsrcSlot(const uint64_t rsrcId);
+
+  /** @brief stores the texture in the slot of the resource
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param SDL_Texture *  - the texture (nullptr to clear the slot)
+   *
+   *  @return bool          - false, if the resource is not registered
+   * */
+  bool setRsrcSlotTexture(const uint64_t rsrcId, SDL_Texture *texture);
+
+  /** @brief logs the stale and mismatching handles
+   * */
+  bool isValidRsrcHandle(const RsrcHandle rsrcHandle,
+                         const uint64_t rsrcId) const;
+
   /** @brief used to load a single Surface
    *
    *  @param const ResourceData * - populated structure with
@@ -274,8 +346,17 @@ class ResourceContainer {
   // to be able to push RendererCmd's
   Renderer *_renderer;
 
-  //_rsrcMap holds all Images
-  std::unordered_map<uint64_t, SDL_Texture *> _rsrcMap;
+  // dense texture slot index for every registered Image
+  std::unordered_map<uint64_t, uint32_t> _rsrcSlots;
+
+  // indexed by texture slot. nullptr - the texture is not loaded
+  std::vector<SDL_Texture *> _rsrcTextures;
+
+  // the rsrcId, every texture slot is registered for
+  std::vector<uint64_t> _rsrcSlotOwners;
+
+  // stored in the issued handles. Unique between the container instances
+  uint32_t _rsrcHandleGeneration;
 
   //_rsrcDataMap holds resource specific information for every Image
   std::unordered_map<uint64_t, ResourceData> _rsrcDataMap;
@@ -283,7 +364,7 @@ class ResourceContainer {
   /** A copy of the resourceData's (used for
    *                                     multithread loading of resources)
    *  */
-  ThreadSafeQueue<ResourceData> *_resDataThreadQueue;
+  ThreadSafeQueue<SurfaceLoadJob> *_resDataThreadQueue;
 
   /** Holds all loaded SDL_Surface's during initiliazation (used for
    *                                     multithread loading of resources)
@@ -295,6 +376,12 @@ class ResourceContainer {
   ThreadSafeQueue<std::pair<uint64_t, SDL_Surface *>>
       *_loadedSurfacesThreadQueue;
 
+  /** Completion slots of the on demand load requests.
+   *  The worker threads deliver the surfaces of the on demand loaded
+   *  resources there instead of the _loadedSurfacesThreadQueue
+   *  */
+  SurfaceLoadBatchPool _surfaceLoadBatchPool;
+
   /* Spawn threads responsible for doing the CPU work (loading resources
    * out of hard-drive to SDL_Surface * 'pixel representation')
    *
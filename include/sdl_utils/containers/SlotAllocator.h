@@ -0,0 +1,121 @@
+#ifndef SDL_UTILS_SLOTALLOCATOR_H_
+#define SDL_UTILS_SLOTALLOCATOR_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+struct SlotAllocatorStats {
+  // slots, reserved on ::init()
+  int32_t capacity = 0;
+
+  // currently allocated slots
+  int32_t occupied = 0;
+
+  // the most slots, that were allocated at the same time
+  int32_t peakOccupied = 0;
+
+  // highest occupied slot index + 1
+  int32_t usedSpan = 0;
+
+  // free slots below usedSpan - what a compaction would give back
+  int32_t compactableSlots = 0;
+};
+
+/** Fixed capacity slot allocator, handing out generation tagged ids.
+ *
+ *  An id holds the slot index in the low INDEX_BITS and the slot
+ *  generation above them. The generation is increased every time the
+ *  slot is released, so an id, which outlived its slot is detected
+ *  instead of silently aliasing the next owner of the same slot.
+ *  The ids are always non-negative, so -1 keeps meaning "not set".
+ *
+ *  Free slots are kept in a LIFO free-list - allocate and release are O(1).
+ *  The most recently released (still cache hot) slots are reused first.
+ *
+ *  NOTE: not thread safe. The owning container accesses it only
+ *        from the update thread.
+ * */
+class SlotAllocator {
+ public:
+  enum InternalDefines : int32_t {
+    INDEX_BITS = 20,
+    INDEX_MASK = (1 << INDEX_BITS) - 1,
+    GENERATION_BITS = 31 - INDEX_BITS,
+    GENERATION_MASK = (1 << GENERATION_BITS) - 1,
+    MAX_CAPACITY = 1 << INDEX_BITS
+  };
+
+  /** @brief used to reserve the slots
+   *
+   *  @param const int32_t - slots count (up to MAX_CAPACITY)
+   *
+   *  @return ErrorCode    - error code
+   * */
+  ErrorCode init(const int32_t capacity);
+
+  void deinit();
+
+  /** @brief occupies a free slot
+   *
+   *  @param int32_t &  - out generation tagged slot id
+   *
+   *  @return ErrorCode - error code (FAILURE if all slots are occupied)
+   * */
+  ErrorCode allocate(int32_t &outId);
+
+  /** @brief frees the slot of an id, previously returned by ::allocate()
+   *
+   *  @param const int32_t - slot id
+   *
+   *  @return ErrorCode    - error code (FAILURE for stale or invalid ids)
+   * */
+  ErrorCode release(const int32_t id);
+
+  /** @brief checks whether the id still owns its slot
+   * */
+  bool isAlive(const int32_t id) const {
+    if (0 > id) {
+      return false;
+    }
+    const int32_t idx = getIndex(id);
+    return (idx < _capacity) && _occupied[idx] && (_generations[idx] ==
+        ((id >> INDEX_BITS) & GENERATION_MASK));
+  }
+
+  static int32_t getIndex(const int32_t id) {
+    return id & INDEX_MASK;
+  }
+
+  /** @brief O(capacity) - intended for diagnostics only
+   * */
+  SlotAllocatorStats getStats() const;
+
+  /** @brief logs the occupancy and compaction statistics
+   *
+   *  @param const char * - name of the owning container
+   * */
+  void logStats(const char *ownerName) const;
+
+ private:
+  // LIFO stack of the free slot indexes
+  std::vector<int32_t> _freeSlots;
+
+  // current generation of every slot
+  std::vector<int32_t> _generations;
+
+  std::vector<uint8_t> _occupied;
+
+  int32_t _capacity = 0;
+  int32_t _occupiedCount = 0;
+  int32_t _peakOccupiedCount = 0;
+};
+
+#endif /* SDL_UTILS_SLOTALLOCATOR_H_ */
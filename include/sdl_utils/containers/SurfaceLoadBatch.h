@@ -0,0 +1,94 @@
+#ifndef SDL_UTILS_SURFACELOADBATCH_H_
+#define SDL_UTILS_SURFACELOADBATCH_H_
+
+// System headers
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+
+// Own components headers
+
+// Forward declarations
+struct SDL_Surface;
+
+/** Completion slot of a single on demand texture load request.
+ *
+ *  The worker threads deliver the decoded surfaces of the request
+ *  directly into its batch. The renderer thread consumes them in
+ *  completion order - it never sees surfaces of other requests,
+ *  so no searching and no requeueing is needed.
+ *
+ *  A nullptr surface is delivered for a resource, which failed to load,
+ *  so the renderer thread always receives the requested count.
+ * */
+class SurfaceLoadBatch : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief delivers a decoded surface. Invoked by the worker threads
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param SDL_Surface *  - decoded surface (nullptr on failure)
+   * */
+  void push(const uint64_t rsrcId, SDL_Surface *surface);
+
+  /** @brief blocks until the next surface of the batch is delivered
+   *
+   *  @param std::pair<uint64_t, SDL_Surface *> & - delivered surface
+   *
+   *  @return bool - false, if the batch was shut down
+   * */
+  bool waitAndPop(std::pair<uint64_t, SDL_Surface *> &outRsrcSurface);
+
+  /** @brief wakes up and fails all current and future ::waitAndPop() calls
+   * */
+  void shutdown();
+
+  /** @brief prepares the batch for a new request
+   * */
+  void reset();
+
+ private:
+  std::mutex _mutex;
+  std::condition_variable _completedCondVar;
+
+  // delivered surfaces in completion order
+  std::vector<std::pair<uint64_t, SDL_Surface *>> _completed;
+
+  // _completed elements, already popped by the renderer thread
+  uint64_t _consumedCount = 0;
+
+  bool _isShutdowned = false;
+};
+
+/** Recycles the SurfaceLoadBatch instances.
+ *
+ *  The batches are acquired by the update thread when the load request
+ *  is issued and released by the renderer thread after it consumed
+ *  all requested surfaces. The batches are never freed before ::deinit(),
+ *  so the steady state requests perform no heap allocations.
+ * */
+class SurfaceLoadBatchPool : public NonCopyable, public NonMoveable {
+ public:
+  SurfaceLoadBatch *acquire();
+
+  void release(SurfaceLoadBatch *batch);
+
+  /** @brief shuts down all batches, which are still in flight
+   * */
+  void shutdown();
+
+  void deinit();
+
+ private:
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<SurfaceLoadBatch>> _batches;
+  std::vector<SurfaceLoadBatch *> _freeBatches;
+};
+
+#endif /* SDL_UTILS_SURFACELOADBATCH_H_ */
@@ -10,6 +10,7 @@
 #include "utils/ErrorCode.h"
 
 // Own components headers
+#include "sdl_utils/containers/SlotAllocator.h"
 #include "sdl_utils/drawing/defines/RendererDefines.h"
 
 // Forward declarations
@@ -129,6 +130,15 @@ class TextContainer {
    * */
    uint64_t getGPUMemoryUsage() const { return _gpuMemoryUsage; }
 
+  /** @brief used to acquire the occupancy statistics of the text slots
+   *         NOTE: O(maxRuntimeTexts) - intended for diagnostics only
+   *
+   *  @return SlotAllocatorStats - text slots statistics
+   * */
+  SlotAllocatorStats getTextSlotStats() const {
+    return _textSlots.getStats();
+  }
+
  private:
   // holds pointer to hardware render in order
   // to be able to push RendererCmd's
@@ -143,13 +153,19 @@ class TextContainer {
    *
    * NOTE: do NOT resize the vector. This will crash the program
    *
-   * NOTE2: When text is deleted - do not remove it from the structure.
-   *        Instead - simply leave the vector element with nullptr value.
-   *        When new text is added - simply linearly scan the array and
-   *        search for a free position (nullptr value).
+   * NOTE2: The vectors are indexed by SlotAllocator::getIndex(textId).
+   *        When text is deleted - its slot is returned to _textSlots
+   *        and the vector element is left with nullptr value.
    **/
   std::vector<SDL_Texture*> _texts;
 
+  // holds the generation tagged id of the attached text for every slot.
+  // Used by the renderer thread to reject stale text ids
+  std::vector<int32_t> _textIds;
+
+  // hands out the text ids. Accessed only by the update thread
+  SlotAllocator _textSlots;
+
   // holds holds many bytes the current text occupied in GPU VRAM
   std::vector<uint64_t> _textMemoryUsage;
 
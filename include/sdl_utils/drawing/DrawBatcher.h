@@ -0,0 +1,98 @@
+#ifndef SDL_UTILS_DRAWBATCHER_H_
+#define SDL_UTILS_DRAWBATCHER_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct FrameWidgets;
+struct SDL_Renderer;
+struct SDL_Texture;
+
+/** Groups consecutive widgets, sharing the same SDL_Texture, into a single
+ *  vertex/index array which is submitted with one SDL_RenderGeometry() call.
+ *
+ *  Rotation, flip, crop and scaling are baked into the generated vertices.
+ *  Widget opacity is baked into the vertex colors, because SDL_RenderGeometry
+ *  ignores the texture alpha modulation. Blend mode is a texture property,
+ *  so it is constant for the whole batch.
+ *
+ *  NOTE: widgets, which are both rotated and clipped (crop with scaling)
+ *        can not be represented with vertices, because the clip rectangle is
+ *        applied after the rotation. Such widgets are rejected and should be
+ *        drawn with Texture::draw() after the current batch is flushed.
+ * */
+class DrawBatcher : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief used to initialise the draw batcher
+   *
+   *  @param SDL_Renderer *  - the hardware renderer
+   *  @param const uint32_t  - max widgets in a single batch
+   *
+   *  @return ErrorCode      - error code
+   * */
+  ErrorCode init(SDL_Renderer *renderer, const uint32_t maxBatchWidgets);
+
+  /** @brief appends the widget to the current batch.
+   *         A change in the texture flushes the current batch.
+   *
+   *  @param const FrameWidgets & - widgets of the frame
+   *                                (with resolved textures)
+   *  @param const uint32_t       - row of the widget
+   *
+   *  @return bool - false if the widget could not be batched
+   * */
+  bool addWidget(const FrameWidgets &widgets, const uint32_t idx);
+
+  /** @brief submits the accumulated batch (if any) to the renderer
+   * */
+  void flush();
+
+ private:
+  /** Layout compatible with SDL_Vertex.
+   *  SDL headers are private for the library, so they can not be
+   *  included here.
+   * */
+  struct Vertex {
+    float x = 0.f;
+    float y = 0.f;
+    uint8_t r = 0;
+    uint8_t g = 0;
+    uint8_t b = 0;
+    uint8_t a = 0;
+    float u = 0.f;
+    float v = 0.f;
+  };
+
+  bool beginBatch(SDL_Texture *texture);
+
+  SDL_Renderer *_renderer = nullptr;
+
+  SDL_Texture *_batchTexture = nullptr;
+
+  // used to normalise the source rectangle into texture coordinates
+  float _invTextureWidth = 0.f;
+  float _invTextureHeight = 0.f;
+
+  // texture alpha modulation at the time the batch was started
+  uint8_t _textureAlphaMod = 0;
+
+  std::vector<Vertex> _vertices;
+
+  /** Quad indices are the same for every batch.
+   *  They are generated once on ::init()
+   * */
+  std::vector<int32_t> _indices;
+
+  uint32_t _maxBatchWidgets = 0;
+};
+
+#endif /* SDL_UTILS_DRAWBATCHER_H_ */
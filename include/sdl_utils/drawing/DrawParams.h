@@ -29,6 +29,13 @@ struct DrawParams {
       int32_t spriteBufferId;
   };
 
+  /** Optional dense handle for WidgetType::IMAGE, resolved once with
+   *  ResourceContainer::getRsrcHandle(). Replaces the rsrcId hash lookup
+   *  on the renderer thread with an array index.
+   *  INVALID_RSRC_HANDLE - the texture is looked up by rsrcId
+   * */
+  RsrcHandle rsrcHandle;
+
   // Top left position of texture
   Point pos;
 
@@ -54,6 +61,11 @@ struct DrawParams {
   // Holds Widget opacity (where 0 is full transparent and 255 is full opacity)
   int32_t opacity;
 
+  /** Draw layer (depth). Widgets with lower layers are drawn first.
+   *  Widgets on the same layer are drawn in submission order
+   * */
+  uint16_t layer;
+
   // Holds the specific widget type (IMAGE, TEXT, SPRITE_BUFFER, etc...)
   WidgetType widgetType;
 
@@ -0,0 +1,79 @@
+#ifndef SDL_UTILS_DRAWPARAMSCODEC_H_
+#define SDL_UTILS_DRAWPARAMSCODEC_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+struct DrawParams;
+
+/** Packed wire format for DrawParams, used to reduce the bytes moved from
+ *  the update thread to the renderer thread.
+ *
+ *  Every encoded widget starts with a 16 bit header, which holds the
+ *  widgetType, widgetFlipType, hasCrop and hasScaling values together with
+ *  the presence flags for the optional fields. The header is followed by:
+ *    > container id   - 8 bytes for WidgetType::IMAGE, 4 bytes otherwise;
+ *    > pos            - only without crop (Texture::draw() ignores it);
+ *    > frameRect;
+ *    > scaled size    - only with scaling;
+ *    > frameCropRect  - only with crop;
+ *    > rotCenter and angle - only for non-zero angle. The angle is stored
+ *                      as float, when this is lossless;
+ *    > opacity        - 1 byte, only for non-full opacity;
+ *    > layer          - 2 bytes, only for non-zero layer.
+ *
+ *  The process local rsrcHandle is not encoded. The decoded widgets are
+ *  resolved by rsrcId.
+ *
+ *  Coordinates are stored as int16, unless any of them does not fit.
+ *  Decoding produces DrawParams, which are drawn identically to the
+ *  encoded ones.
+ * */
+class DrawParamsCodec {
+public:
+  DrawParamsCodec() = delete;
+
+  enum InternalDefines : uint32_t {
+    // 16 bit header, 64 bit id, 14 x int32 coordinates, double angle,
+    // opacity, layer
+    MAX_ENCODED_SIZE = 2 + 8 + (14 * 4) + 8 + 1 + 2
+  };
+
+  /** @brief encodes the draw params
+   *
+   *  @param const DrawParams & - draw specific data for a single Widget
+   *  @param uint8_t *          - output buffer
+   *                              (at least MAX_ENCODED_SIZE bytes)
+   *
+   *  @return uint32_t          - populated bytes
+   * */
+  static uint32_t encode(const DrawParams &drawParams, uint8_t *outData);
+
+  /** @brief decodes draw params, previously populated by ::encode()
+   *
+   *  @param const uint8_t *    - input buffer
+   *  @param DrawParams &       - decoded draw specific data
+   *
+   *  @return uint32_t          - parsed bytes
+   * */
+  static uint32_t decode(const uint8_t *data, DrawParams &outDrawParams);
+
+  /** @brief encodes an array of draw params
+   *
+   *  @param const DrawParams [] - draw specific data for Widgets
+   *  @param const uint32_t      - widgets count
+   *  @param uint8_t *           - output buffer
+   *                               (at least size * MAX_ENCODED_SIZE bytes)
+   *
+   *  @return uint64_t           - populated bytes
+   * */
+  static uint64_t encodeArray(const DrawParams drawParamsArr[],
+                              const uint32_t size, uint8_t *outData);
+};
+
+#endif /* SDL_UTILS_DRAWPARAMSCODEC_H_ */
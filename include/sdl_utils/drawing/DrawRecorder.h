@@ -0,0 +1,79 @@
+#ifndef SDL_UTILS_DRAWRECORDER_H_
+#define SDL_UTILS_DRAWRECORDER_H_
+
+// System headers
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "sdl_utils/drawing/DrawParams.h"
+
+// Forward declarations
+
+/** Draw commands recording buffer for a single producer thread
+ *  (e.g. one per UI panel or layer). The recording takes no locks.
+ *
+ *  The recorders are owned by the Renderer (see Renderer::getDrawRecorder())
+ *  and are merged into the frame on Renderer::finishFrame_UT() in ascending
+ *  sort key order (equal keys - in ascending recorder index order).
+ *  The merged widgets are drawn after the ones, added directly with
+ *  Renderer::addDrawCmd_UT().
+ *
+ *  NOTE: the producer threads should complete the recording before
+ *        Renderer::finishFrame_UT() is invoked
+ *        (e.g. by joining the parallel scene traversal).
+ *
+ *  Aligned to a cache line, so neighbouring recorders, written by
+ *  different threads, don't share one.
+ * */
+class alignas(CACHE_LINE_SIZE) DrawRecorder : public NonCopyable,
+                                              public NonMoveable {
+ public:
+  /** @brief reserves the recording storage.
+   *         The storage grows on demand and keeps its capacity
+   *         between the frames.
+   *
+   *  @param const uint32_t - widgets to reserve storage for
+   * */
+  void init(const uint32_t reservedWidgets);
+
+  void setSortKey(const uint32_t sortKey) {
+    _sortKey = sortKey;
+  }
+
+  uint32_t getSortKey() const {
+    return _sortKey;
+  }
+
+  void addDrawCmd(const DrawParams &drawParams) {
+    _drawCmds.push_back(drawParams);
+  }
+
+  void addDrawCmds(const std::span<const DrawParams> drawParams);
+
+  std::span<const DrawParams> getDrawCmds() const {
+    return _drawCmds;
+  }
+
+  bool empty() const {
+    return _drawCmds.empty();
+  }
+
+  /** @brief drops the recorded widgets. The capacity is kept
+   * */
+  void clear() {
+    _drawCmds.clear();
+  }
+
+ private:
+  std::vector<DrawParams> _drawCmds;
+  uint32_t _sortKey = 0;
+};
+
+#endif /* SDL_UTILS_DRAWRECORDER_H_ */
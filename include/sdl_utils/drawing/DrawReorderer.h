@@ -0,0 +1,93 @@
+#ifndef SDL_UTILS_DRAWREORDERER_H_
+#define SDL_UTILS_DRAWREORDERER_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/drawing/Rectangle.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct SDL_Texture;
+struct FrameWidgets;
+
+/** Reorders the widgets of a frame in order to reduce the texture switches
+ *  (and therefore increase the length of the draw batches).
+ *
+ *  Every widget is moved back to the latest preceding group of widgets with
+ *  the same texture, as long as it's draw boundary does not overlap any of
+ *  the widgets drawn in between. Since only non-overlapping widgets swap
+ *  their draw order - the final image stays identical.
+ *
+ *  The search for a matching group is bounded by MAX_LOOKBEHIND_GROUPS
+ *  in order to keep the pass linear in the number of widgets.
+ * */
+class DrawReorderer : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief used to initialise the draw reorderer
+   *
+   *  @param const uint32_t - max number of widgets in a single frame
+   *
+   *  @return ErrorCode     - error code
+   * */
+  ErrorCode init(const uint32_t maxWidgets);
+
+  /** @brief reorders the provided widgets in place.
+   *         The texture column of the widgets must be already resolved.
+   *
+   *  @param FrameWidgets &              - widgets to reorder
+   *  @param const uint32_t              - widgets count
+   *  @param uint32_t &                  - texture switches before reorder
+   *  @param uint32_t &                  - texture switches after reorder
+   * */
+  void reorder(FrameWidgets &widgets, const uint32_t size,
+               uint32_t &outSwitchesBefore, uint32_t &outSwitchesAfter);
+
+ private:
+  enum InternalDefines {
+    MAX_LOOKBEHIND_GROUPS = 64,
+    INVALID_NODE = -1
+  };
+
+  struct Group {
+    SDL_Texture *texture = nullptr;
+
+    // union of the draw boundaries of all group members
+    Rectangle boundary;
+
+    int32_t firstNode = INVALID_NODE;
+    int32_t lastNode = INVALID_NODE;
+  };
+
+  void resize(const uint32_t size);
+
+  bool overlapsGroup(const Group &group, const Rectangle &boundary) const;
+
+  /** @brief applies the _drawOrder permutation with row swaps, so only
+   *         a single copy of every row column is kept
+   * */
+  void applyDrawOrder(FrameWidgets &widgets, const uint32_t size);
+
+  std::vector<Group> _groups;
+
+  // draw boundary for every widget of the frame
+  std::vector<Rectangle> _boundaries;
+
+  // intrusive linked list of the widgets of every group
+  std::vector<int32_t> _nextNode;
+
+  // original row index for every draw position
+  std::vector<uint32_t> _drawOrder;
+
+  // bookkeeping of the in place permutation
+  std::vector<uint32_t> _rowPosition;
+  std::vector<uint32_t> _positionRow;
+};
+
+#endif /* SDL_UTILS_DRAWREORDERER_H_ */
@@ -0,0 +1,82 @@
+#ifndef SDL_UTILS_FRAMEARENA_H_
+#define SDL_UTILS_FRAMEARENA_H_
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+/** A bump allocator for the transient renderer thread allocations
+ *  (texts, file names, resource ids, widget batches) of a single frame.
+ *
+ *  The memory is released all at once with ::reset() at the end of the
+ *  frame. Requests, which do not fit in the block, are served from
+ *  separate heap blocks. On the following ::reset() the block is grown
+ *  to the frame high-water mark, so the steady state frames perform
+ *  no heap allocations at all.
+ *
+ *  NOTE: accessed only by the renderer thread
+ * */
+class FrameArena {
+ public:
+  ErrorCode init(const uint64_t capacity);
+
+  /** @brief allocates uninitialised memory, valid until the next ::reset()
+   *
+   *  @param const uint64_t - bytes count
+   *  @param const uint64_t - alignment (power of 2)
+   *
+   *  @return void *        - the allocated memory
+   * */
+  void *allocate(const uint64_t bytes,
+                 const uint64_t alignment = alignof(std::max_align_t));
+
+  template <typename T>
+  T *allocateArray(const uint64_t count) {
+    return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+  }
+
+  /** @brief releases all allocations of the frame
+   * */
+  void reset();
+
+  /** @brief bytes, allocated in the frame before the last ::reset()
+   * */
+  uint64_t getLastFrameUsedBytes() const {
+    return _lastFrameUsedBytes;
+  }
+
+  /** @brief heap allocations, made in the frame before the last ::reset()
+   *         (including the block growth on the ::reset() itself)
+   * */
+  uint32_t getLastFrameHeapAllocations() const {
+    return _lastFrameHeapAllocations;
+  }
+
+  uint64_t capacity() const {
+    return _capacity;
+  }
+
+ private:
+  std::unique_ptr<uint8_t[]> _block;
+  uint64_t _capacity = 0;
+  uint64_t _usedBytes = 0;
+
+  // requests, which did not fit in the block in the current frame
+  std::vector<std::unique_ptr<uint8_t[]>> _overflowBlocks;
+  uint64_t _overflowBytes = 0;
+
+  uint32_t _heapAllocations = 0;
+  uint32_t _lastFrameHeapAllocations = 0;
+  uint64_t _lastFrameUsedBytes = 0;
+};
+
+#endif /* SDL_UTILS_FRAMEARENA_H_ */
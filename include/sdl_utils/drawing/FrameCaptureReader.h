@@ -0,0 +1,68 @@
+#ifndef SDL_UTILS_FRAMECAPTUREREADER_H_
+#define SDL_UTILS_FRAMECAPTUREREADER_H_
+
+// System headers
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/FrameCaptureDefines.h"
+
+// Forward declarations
+
+/** Reads the frames, recorded by FrameCaptureWriter.
+ *  The frames could be re-executed with Renderer::replayFrame_UT().
+ * */
+class FrameCaptureReader : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief opens the capture file and validates its header
+   *
+   *  @param const std::string & - capture file path
+   *
+   *  @return ErrorCode          - error code
+   * */
+  ErrorCode open(const std::string &file);
+
+  void close();
+
+  const FrameCaptureHeader& getHeader() const {
+    return _header;
+  }
+
+  /** @brief seeks back to the first captured frame
+   * */
+  void rewind();
+
+  /** @brief reads the next captured frame
+   *
+   *  @param CapturedFrame & - the decoded frame
+   *
+   *  @return bool           - false, when there are no more frames
+   *                           or the file is corrupted
+   * */
+  bool readFrame(CapturedFrame &outFrame);
+
+ private:
+  template <typename T>
+  bool read(T &outValue) {
+    _ifstr.read(reinterpret_cast<char*>(&outValue), sizeof(outValue));
+    return static_cast<bool>(_ifstr);
+  }
+
+  std::ifstream _ifstr;
+  std::streampos _firstFramePos;
+  FrameCaptureHeader _header;
+  uint32_t _readFrames = 0;
+
+  //scratch buffer for the DrawParamsCodec encoded widgets
+  std::vector<uint8_t> _encodedWidgets;
+};
+
+#endif /* SDL_UTILS_FRAMECAPTUREREADER_H_ */
@@ -0,0 +1,90 @@
+#ifndef SDL_UTILS_FRAMECAPTUREWRITER_H_
+#define SDL_UTILS_FRAMECAPTUREWRITER_H_
+
+// System headers
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/FrameCaptureDefines.h"
+
+// Forward declarations
+struct RendererState;
+
+/** Records the exact RendererCmd stream, renderData bytes and widgets
+ *  of the frames, handed by the update thread to the renderer thread.
+ *
+ *  The recording starts on the first frame boundary after ::open(), so
+ *  a frame is never captured partially.
+ *
+ *  NOTE: accessed only by the update thread
+ * */
+class FrameCaptureWriter : public NonCopyable, public NonMoveable {
+ public:
+  ~FrameCaptureWriter() noexcept;
+
+  /** @brief creates the capture file
+   *
+   *  @param const std::string & - capture file path
+   *  @param const uint32_t      - frames to capture before the file
+   *                               is closed automatically
+   *  @param const int32_t       - captured window width
+   *  @param const int32_t       - captured window height
+   *
+   *  @return ErrorCode          - error code
+   * */
+  ErrorCode open(const std::string &file, const uint32_t framesCount,
+                 const int32_t windowWidth, const int32_t windowHeight);
+
+  /** @brief finalizes the header and closes the capture file
+   * */
+  void close();
+
+  bool isOpen() const {
+    return _ofstr.is_open();
+  }
+
+  /** @brief appends bytes, written in the renderData of the current frame
+   * */
+  void recordData(const uint8_t *data, const uint64_t bytes) {
+    if (_isRecording) {
+      _frameData.insert(_frameData.end(), data, data + bytes);
+    }
+  }
+
+  /** @brief writes the frame record for the populated renderer state.
+   *         Must be invoked before the state is handed to the renderer
+   *
+   *  @param const RendererState & - the populated state
+   * */
+  void finishFrame(const RendererState &state);
+
+ private:
+  void writeHeader();
+
+  template <typename T>
+  void write(const T value) {
+    _ofstr.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  std::ofstream _ofstr;
+  FrameCaptureHeader _header;
+  uint32_t _requestedFramesCount = 0;
+
+  //renderData bytes of the current frame
+  std::vector<uint8_t> _frameData;
+
+  //scratch buffer for the DrawParamsCodec encoded widgets
+  std::vector<uint8_t> _encodedWidgets;
+
+  bool _isRecording = false;
+};
+
+#endif /* SDL_UTILS_FRAMECAPTUREWRITER_H_ */
@@ -0,0 +1,195 @@
+#ifndef SDL_UTILS_FRAMEHANDOFF_H_
+#define SDL_UTILS_FRAMEHANDOFF_H_
+
+// System headers
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+
+// Forward declarations
+
+/** A single-producer/single-consumer handoff of RendererState slots
+ *  between the update(producer) and the renderer(consumer) thread.
+ *
+ *  The frames are handed over in order. Frame N occupies the slot stored
+ *  at position (N % slotsCount) of the slot order table. Both threads
+ *  advance their position by one on every handoff, so only the number of
+ *  published, acquired and released frames needs to be shared between
+ *  the threads. The table itself is modified only when the newest pending
+ *  frame is replaced (see ::replacePendingFrame_UT()).
+ *
+ *  Two policies are supported:
+ *    > FrameHandoffPolicy::CONDITION_VARIABLE - two mutexes and
+ *      two condition variables (the original synchronisation mechanism);
+ *    > FrameHandoffPolicy::LOCK_FREE - atomic counters, placed on separate
+ *      cache lines. Waiting is done by spinning for a short period,
+ *      after which the thread is parked on the counter (futex on Linux).
+ *      The other side issues a wake-up only if the waiting thread is
+ *      actually parked, so the steady state has no kernel transitions.
+ * */
+class FrameHandoff : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief used to initialise the frame handoff
+   *
+   *  @param const FrameHandoffPolicy - synchronisation policy
+   *  @param const uint32_t           - number of RendererState slots
+   *
+   *  @return ErrorCode               - error code
+   * */
+  ErrorCode init(const FrameHandoffPolicy policy, const uint32_t slotsCount);
+
+  /** @brief blocks the update thread until the next slot is released
+   *         by the renderer thread
+   *
+   *  @return bool - false if the renderer has already been shutdowned
+   * */
+  bool waitForFreeSlot_UT();
+
+  /** @brief used to check whether the update thread can publish a frame
+   *         without blocking
+   *
+   *  @return bool - is free slot available
+   * */
+  bool hasFreeSlot_UT() const;
+
+  /** @brief takes back the newest published frame, if the renderer thread
+   *         has still not acquired it. The slot, populated by the update
+   *         thread, takes it's place in the queue, while the slot of the
+   *         taken back frame becomes the new update thread slot.
+   *
+   *         NOTE: a successful replace must be followed by
+   *               ::publishFrame_UT()
+   *
+   *  @return bool - is the pending frame replaced
+   * */
+  bool replacePendingFrame_UT();
+
+  /** @brief used to acquire the slot currently populated by the update
+   *         thread
+   *
+   *  @return uint32_t - slot index
+   * */
+  uint32_t getUpdateSlot_UT() const;
+
+  /** @brief used to acquire the slot of the newest published frame.
+   *         The slot may already be acquired by the renderer thread.
+   *
+   *  @return uint32_t - slot index
+   * */
+  uint32_t getNewestPublishedSlot_UT() const;
+
+  /** @brief publishes the currently populated update thread slot to the
+   *         renderer thread
+   * */
+  void publishFrame_UT();
+
+  /** @brief blocks the renderer thread until a frame is published
+   *         and acquires it
+   *
+   *  @return uint32_t - slot index of the acquired frame
+   * */
+  uint32_t waitForFrame_RT();
+
+  /** @brief marks the currently processed frame as finished, which makes
+   *         it's slot available to the update thread
+   * */
+  void releaseFrame_RT();
+
+  /** @brief wakes the update thread (if it is waiting) and forbids
+   *         further frame handoffs
+   * */
+  void shutdown_RT();
+
+  /** @brief used to acquire the number of published frames that are still
+   *         not released by the renderer thread
+   *
+   *  @return uint32_t - frames in flight
+   * */
+  uint32_t getFramesInFlight() const;
+
+  FrameHandoffPolicy getPolicy() const { return _policy; }
+
+  uint32_t getSlotsCount() const { return _slotsCount; }
+
+ private:
+  bool waitForFreeSlotCondVar();
+  bool waitForFreeSlotLockFree();
+  void acquireFrameLockFree(const uint32_t acquiredFrames);
+  bool replacePendingFrameLockFree(const uint32_t publishedFrames);
+
+  bool hasFreeSlot(const uint32_t publishedFrames,
+                   const uint32_t releasedFrames) const {
+    return (publishedFrames - releasedFrames) < _maxFramesInFlight;
+  }
+
+  struct alignas(CACHE_LINE_SIZE) PaddedCounter {
+    std::atomic<uint32_t> value { 0 };
+  };
+
+  /** Number of frames published by the update thread.
+   *  Written only by the update thread.
+   * */
+  PaddedCounter _publishedFrames;
+
+  /** Number of frames released by the renderer thread.
+   *  Written only by the renderer thread.
+   * */
+  PaddedCounter _releasedFrames;
+
+  /** Number of frames acquired by the renderer thread.
+   *  Written only by the renderer thread. Read by the update thread
+   *  only when replacing a pending frame.
+   * */
+  PaddedCounter _acquiredFrames;
+
+  /** Cold data - only touched when one of the threads is about to park.
+   *  Kept away from the counters in order to avoid false sharing.
+   * */
+  alignas(CACHE_LINE_SIZE) std::atomic<bool> _isProducerParked { false };
+  std::atomic<bool> _isConsumerParked { false };
+  std::atomic<bool> _isShutdowned { false };
+
+  /** used for FrameHandoffPolicy::CONDITION_VARIABLE
+   *
+   *      Direction: update thread --> renderer thread
+   **/
+  std::mutex _updateMutex;
+  std::condition_variable _updateCondVar;
+
+  /** used for FrameHandoffPolicy::CONDITION_VARIABLE
+   *
+   *      Direction: renderer thread --> update thread
+   **/
+  std::mutex _renderMutex;
+  std::condition_variable _renderCondVar;
+
+  FrameHandoffPolicy _policy = FrameHandoffPolicy::CONDITION_VARIABLE;
+
+  /** Maps frame positions to slots. Written only by the update thread.
+   *  The publishing of a frame makes the written entry visible to
+   *  the renderer thread.
+   * */
+  std::array<uint32_t, MAX_RENDERER_PIPELINE_DEPTH> _slotOrder { };
+
+  uint32_t _slotsCount = MIN_RENDERER_PIPELINE_DEPTH;
+
+  /** The update thread always owns one slot, which it populates.
+   *  The rest of the slots could be in flight.
+   * */
+  uint32_t _maxFramesInFlight = 1;
+
+  // busy-wait iterations before a waiting thread is parked
+  uint32_t _spinIterations = 0;
+};
+
+#endif /* SDL_UTILS_FRAMEHANDOFF_H_ */
@@ -0,0 +1,180 @@
+#ifndef SDL_UTILS_FRAMEWIDGETS_H_
+#define SDL_UTILS_FRAMEWIDGETS_H_
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+// Other libraries headers
+#include "utils/drawing/Point.h"
+#include "utils/drawing/Rectangle.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "sdl_utils/drawing/DrawParams.h"
+
+// Forward declarations
+struct SDL_Texture;
+
+/** Allocates the storage on a cache line boundary, so SIMD kernels could
+ *  process the columns without straddling cache lines.
+ * */
+template <typename T>
+struct CacheAlignedAllocator {
+  using value_type = T;
+
+  CacheAlignedAllocator() = default;
+
+  template <typename U>
+  CacheAlignedAllocator(const CacheAlignedAllocator<U> &) {}
+
+  T* allocate(const size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T),
+        std::align_val_t(CACHE_LINE_SIZE)));
+  }
+
+  void deallocate(T *ptr, const size_t) {
+    ::operator delete(ptr, std::align_val_t(CACHE_LINE_SIZE));
+  }
+
+  template <typename U>
+  bool operator==(const CacheAlignedAllocator<U> &) const { return true; }
+
+  template <typename U>
+  bool operator!=(const CacheAlignedAllocator<U> &) const { return false; }
+};
+
+template <typename T>
+using AlignedArray = std::vector<T, CacheAlignedAllocator<T>>;
+
+/** Structure of arrays representation of the widgets for a single frame.
+ *
+ *  DrawParams are decomposed on submission, so the render thread kernels
+ *  touch only the columns they need:
+ *    > hot  - destination quad position and size (global offsets, culling);
+ *    > draw - source rectangles, textures, opacity (batching);
+ *    > cold - rotation and flip.
+ *
+ *  The destination quad is already resolved from the crop and scaling
+ *  settings in the same way as Texture::draw() does it:
+ *    > (x, y, width, height) is the destination quad;
+ *    > (visibleWidth, visibleHeight) is the part of the quad, which is not
+ *      clipped by the renderer clip rectangle (crop with scaling).
+ *
+ *  The columns are addressed by index. The number of populated rows is
+ *  tracked by the owner (as for the rest of the RendererState data).
+ * */
+struct FrameWidgets {
+  enum Flags : uint8_t {
+    NO_FLAGS = 0,
+    IS_ROTATED = 1,
+    IS_CLIPPED = 2
+  };
+
+  ErrorCode init(const uint32_t capacity);
+
+  /** @brief resizes all the columns
+   *
+   *  @param const uint32_t - number of rows
+   * */
+  void resize(const uint32_t capacity);
+
+  uint32_t capacity() const { return static_cast<uint32_t>(x.size()); }
+
+  /** @brief DrawParams compatible submission shim.
+   *         Decomposes the draw params into the row columns.
+   *
+   *  @param const uint32_t     - row index
+   *  @param const DrawParams & - draw specific data for a single Widget
+   * */
+  void setDrawParams(const uint32_t idx, const DrawParams &drawParams);
+
+  /** @brief recomposes DrawParams from the row columns. The result is drawn
+   *         by Texture::draw() in the same way as the originally submitted
+   *         DrawParams.
+   *
+   *  @param const uint32_t - row index
+   *
+   *  @return DrawParams    - draw specific data for a single Widget
+   * */
+  DrawParams getDrawParams(const uint32_t idx) const;
+
+  /** @brief moves the destination quads of the first rows
+   *         (SIMD accelerated)
+   *
+   *  @param const uint32_t - number of rows
+   *  @param const int32_t  - X axis movement
+   *  @param const int32_t  - Y axis movement
+   * */
+  void applyGlobalOffset(const uint32_t size, const int32_t offsetX,
+                         const int32_t offsetY);
+
+  /** @brief evaluates the screen area, touched by the row draw call
+   *
+   *  @param const uint32_t - row index
+   *
+   *  @return Rectangle     - draw boundary (empty, if nothing is drawn)
+   * */
+  Rectangle getDrawBoundary(const uint32_t idx) const;
+
+  /** @brief copies the source row over the destination row
+   * */
+  void copyRow(const uint32_t dstIdx, const uint32_t srcIdx);
+
+  /** @brief swaps the content of two rows
+   * */
+  void swapRows(const uint32_t idxA, const uint32_t idxB);
+
+  /** @brief fast non-cryptographic hash of the first rows.
+   *         Used to detect frames, identical to the previous one.
+   *
+   *  @param const uint32_t - number of rows
+   *
+   *  @return uint64_t      - the rows hash
+   * */
+  uint64_t computeHash(const uint32_t size) const;
+
+  /** @brief fast non-cryptographic hash of a single row.
+   *         Used to detect widgets, identical to the previous frame.
+   *
+   *  @param const uint32_t - row index
+   *
+   *  @return uint64_t      - the row hash
+   * */
+  uint64_t computeRowHash(const uint32_t idx) const;
+
+  // hot data
+  AlignedArray<int32_t> x;
+  AlignedArray<int32_t> y;
+  AlignedArray<int32_t> width;
+  AlignedArray<int32_t> height;
+  AlignedArray<int32_t> visibleWidth;
+  AlignedArray<int32_t> visibleHeight;
+
+  // draw data
+  std::vector<Rectangle> srcRect;
+
+  // rsrcId for WidgetType::IMAGE, textId/spriteBufferId otherwise
+  std::vector<uint64_t> containerId;
+
+  // DrawParams::rsrcHandle for WidgetType::IMAGE
+  std::vector<RsrcHandle> rsrcHandle;
+  std::vector<WidgetType> widgetType;
+  std::vector<int32_t> opacity;
+  std::vector<uint16_t> layer;
+  std::vector<uint8_t> flags;
+
+  // resolved on the renderer thread from containerId and widgetType
+  std::vector<SDL_Texture*> texture;
+
+  // cold data
+  std::vector<double> angle;
+  std::vector<Point> rotCenter;
+  std::vector<WidgetFlipType> flipType;
+};
+
+#endif /* SDL_UTILS_FRAMEWIDGETS_H_ */
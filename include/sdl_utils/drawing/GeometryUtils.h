@@ -4,11 +4,13 @@
 // System headers
 
 // Other libraries headers
+#include "utils/drawing/Point.h"
 #include "utils/drawing/Rectangle.h"
 
 // Own components headers
 
 // Forward declarations
+struct DrawParams;
 
 class GeometryUtils {
 public:
@@ -17,6 +19,40 @@ public:
   static bool findRectIntersection(const Rectangle &srcA,
                                    const Rectangle &srcB,
                                    Rectangle &intersectionResult);
+
+  /** @brief checks whether two rectangles have a non-empty intersection
+   *
+   *         NOTE: defined inline, because it is used in hot loops
+   * */
+  static bool hasRectIntersection(const Rectangle &srcA,
+                                  const Rectangle &srcB) {
+    return (srcA.x < srcB.x + srcB.w) && (srcB.x < srcA.x + srcA.w) &&
+           (srcA.y < srcB.y + srcB.h) && (srcB.y < srcA.y + srcA.h);
+  }
+
+  /** @brief evaluates the screen area, touched by a widget draw call.
+   *         Crop, scaling and rotation are taken into account in the same
+   *         way as in Texture::draw(). Rotated widgets are bounded by the
+   *         axis aligned rectangle of their rotated quad.
+   *
+   *  @param const DrawParams & - draw specific data for a single Widget
+   *
+   *  @return Rectangle         - draw boundary (empty, if nothing is drawn)
+   * */
+  static Rectangle getDrawBoundary(const DrawParams &drawParams);
+
+  /** @brief evaluates the axis aligned boundary of a rotated quad
+   *         (rotation is clockwise, same as SDL_RenderCopyEx())
+   *
+   *  @param const Rectangle & - quad before the rotation
+   *  @param const Point &     - rotation center, relative to the quad
+   *  @param const double      - rotation angle in degrees
+   *
+   *  @return Rectangle        - boundary of the rotated quad
+   * */
+  static Rectangle getRotatedBoundary(const Rectangle &quad,
+                                      const Point &rotCenter,
+                                      const double angle);
 };
 
 #endif /* SDL_UTILS_GEOMETRYUTILS_H_ */
@@ -0,0 +1,43 @@
+#ifndef SDL_UTILS_LAYERSORTER_H_
+#define SDL_UTILS_LAYERSORTER_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+struct FrameWidgets;
+class FrameArena;
+
+/** Orders the widgets of a frame by their draw layer (DrawParams::layer).
+ *
+ *  A stable LSD radix sort with 8 bit digits over the 16 bit layer key -
+ *  O(n), widgets on the same layer keep their submission order.
+ *  The digit passes, in which all widgets share the same digit, are skipped,
+ *  so a frame with a single layer costs a single pass over the layer column.
+ *
+ *  The sort key is extracted into a separate array, so it could later be
+ *  widened (for example combined with a texture id) by adding digit passes.
+ *
+ *  All scratch memory is taken from the renderer thread frame arena.
+ * */
+class LayerSorter {
+public:
+  LayerSorter() = delete;
+
+  /** @brief sorts the first rows by their layer
+   *
+   *  @param FrameWidgets & - widgets to sort
+   *  @param const uint32_t - number of rows
+   *  @param FrameArena &   - arena for the scratch memory
+   *
+   *  @return bool          - were any rows moved
+   * */
+  static bool sort(FrameWidgets &widgets, const uint32_t size,
+                   FrameArena &arena);
+};
+
+#endif /* SDL_UTILS_LAYERSORTER_H_ */
@@ -0,0 +1,131 @@
+#ifndef SDL_UTILS_RENDERDATABUFFER_H_
+#define SDL_UTILS_RENDERDATABUFFER_H_
+
+// System headers
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+/** A growable byte buffer, which holds the renderer commands data for
+ *  a single RendererState.
+ *
+ *  The update thread writes the whole frame data and the renderer thread
+ *  reads it back in the same order. The data is stored in a list of
+ *  chunks:
+ *    > a single ::write() is always stored contiguously in one chunk;
+ *    > when a write does not fit in the current chunk, the next chunk is
+ *      used. A new chunk is allocated only if the frame needs more memory
+ *      than all of the previous frames. The stored data is never moved,
+ *      so the views from ::peekContiguous() stay valid.
+ *
+ *  Once the buffer is fully drained the chunks are rewound and reused
+ *  for the next frame.
+ * */
+class RenderDataBuffer {
+ public:
+  ErrorCode init(const uint64_t chunkCapacity);
+
+  /** @brief appends the data
+   *
+   *  @param const uint8_t *  - inData buffer
+   *  @param const uint64_t   - bytes count to write
+   *
+   *  @return uint64_t        - written bytes
+   * */
+  uint64_t write(const uint8_t *data, const uint64_t bytes);
+
+  /** @brief extracts the oldest data. Reads nothing if there is
+   *         not enough stored data
+   *
+   *  @param uint8_t *        - outData buffer
+   *  @param const uint64_t   - bytes count to read
+   *
+   *  @return uint64_t        - read bytes
+   * */
+  uint64_t read(uint8_t *outData, const uint64_t bytes);
+
+  template <typename T>
+  RenderDataBuffer &operator>>(T &outData) {
+    read(reinterpret_cast<uint8_t*>(&outData), sizeof(T));
+    return *this;
+  }
+
+  /** @brief provides a view to the oldest data without extracting it
+   *
+   *  @param const uint64_t   - bytes count to view
+   *
+   *  @return const uint8_t * - the view or nullptr if the requested bytes
+   *                            are not stored in a single chunk
+   *                            (they were not written with a single
+   *                            ::write() call)
+   *
+   *         NOTE: the view is not aligned. It stays valid until the
+   *               buffer is drained and written again
+   * */
+  const uint8_t *peekContiguous(const uint64_t bytes) const;
+
+  /** @brief drops the oldest data (usually after ::peekContiguous())
+   *
+   *  @param const uint64_t   - bytes count to drop
+   *
+   *  @return uint64_t        - dropped bytes
+   * */
+  uint64_t consume(const uint64_t bytes);
+
+  /** @brief ensures the total chunks capacity, so the next frame of the
+   *         given size is stored without allocations.
+   *         Should be invoked only on an empty buffer.
+   *
+   *  @param const uint64_t   - total bytes
+   * */
+  void reserve(const uint64_t bytes);
+
+  void clear();
+
+  uint64_t size() const {
+    return _size;
+  }
+
+  /** @brief total capacity of all allocated chunks
+   * */
+  uint64_t capacity() const {
+    return _capacity;
+  }
+
+  /** @brief number of chunks, allocated after ::init()
+   * */
+  uint32_t getGrowthsCount() const {
+    return _growthsCount;
+  }
+
+ private:
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> data;
+    uint64_t capacity = 0;
+    uint64_t used = 0;
+  };
+
+  /** @brief allocates a new chunk after the current write chunk
+   * */
+  void insertChunk(const uint64_t capacity);
+
+  std::vector<Chunk> _chunks;
+  uint64_t _chunkCapacity = 0;
+  uint64_t _capacity = 0;
+  uint64_t _size = 0;
+
+  size_t _writeChunk = 0;
+  size_t _readChunk = 0;
+  uint64_t _readPos = 0;
+
+  uint32_t _growthsCount = 0;
+};
+
+#endif /* SDL_UTILS_RENDERDATABUFFER_H_ */
@@ -0,0 +1,96 @@
+#ifndef SDL_UTILS_RENDERSTATECACHE_H_
+#define SDL_UTILS_RENDERSTATECACHE_H_
+
+// System headers
+#include <cstdint>
+#include <unordered_map>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/drawing/Color.h"
+#include "utils/drawing/Rectangle.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+
+// Forward declarations
+struct SDL_Renderer;
+struct SDL_Texture;
+
+/** Shadows the SDL_Renderer state (render target, draw color,
+ *  clip rectangle and the per texture alpha and blend modulation), so
+ *  the SDL calls, which would not change it, are filtered out.
+ *
+ *  The state is expected to be changed only through the cache.
+ *  Textures, which are not tracked, are assumed with FULL_OPACITY alpha
+ *  modulation (the SDL default) and unknown blend mode.
+ *
+ *  The clip rectangle is either the default one (the monitor rectangle)
+ *  or a crop rectangle, set for a single draw. The crop rectangle is
+ *  reset lazily - by the next draw without a crop or by a render target
+ *  change.
+ * */
+class RenderStateCache : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief forgets all of the shadowed state
+   *
+   *  @param SDL_Renderer * - the renderer, whose state is shadowed
+   * */
+  void reset(SDL_Renderer *renderer);
+
+  void setDefaultClipRect(const Rectangle &clipRect) {
+    _defaultClipRect = clipRect;
+  }
+
+  ErrorCode setRenderTarget(SDL_Texture *target);
+
+  ErrorCode setDrawColor(const Color &color);
+
+  ErrorCode setCropClipRect(const Rectangle &clipRect);
+
+  ErrorCode resetClipRect();
+
+  ErrorCode setTextureAlphaMod(SDL_Texture *texture, const uint8_t alpha);
+
+  ErrorCode setTextureBlendMode(SDL_Texture *texture,
+                                const BlendMode blendMode);
+
+  /** @brief must be invoked before the texture is destroyed, because
+   *         SDL could reuse it's address for a new texture
+   * */
+  void forgetTexture(SDL_Texture *texture);
+
+  /** @brief SDL calls, filtered out since the last counter reset
+   * */
+  uint32_t getAvoidedCallsCount() const {
+    return _avoidedCalls;
+  }
+
+  void resetAvoidedCallsCount() {
+    _avoidedCalls = 0;
+  }
+
+ private:
+  SDL_Renderer *_renderer = nullptr;
+
+  SDL_Texture *_target = nullptr;
+  bool _isTargetKnown = false;
+
+  Color _drawColor = Colors::BLACK;
+  bool _isDrawColorKnown = false;
+
+  Rectangle _defaultClipRect;
+  Rectangle _cropClipRect;
+  bool _isCropClipActive = false;
+
+  // only the textures with alpha modulation, different than FULL_OPACITY
+  std::unordered_map<SDL_Texture*, uint8_t> _textureAlphaMods;
+
+  std::unordered_map<SDL_Texture*, BlendMode> _textureBlendModes;
+
+  uint32_t _avoidedCalls = 0;
+};
+
+#endif /* SDL_UTILS_RENDERSTATECACHE_H_ */
@@ -2,26 +2,44 @@
 #define SDL_UTILS_RENDERER_H_
 
 // System headers
-#include <condition_variable>
 #include <cstdint>
-#include <mutex>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
 
 // Other libraries headers
 #include "utils/class/NonCopyable.h"
 #include "utils/class/NonMoveable.h"
+#include "utils/drawing/Color.h"
 #include "utils/ErrorCode.h"
 
 // Own components headers
 #include "sdl_utils/drawing/config/RendererConfig.h"
+#include "sdl_utils/drawing/defines/DrawUtilityDefines.h"
+#include "sdl_utils/drawing/defines/RendererCmdPayloads.h"
 #include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "sdl_utils/drawing/DrawBatcher.h"
+#include "sdl_utils/drawing/DrawRecorder.h"
+#include "sdl_utils/drawing/DrawReorderer.h"
+#include "sdl_utils/drawing/FrameCaptureWriter.h"
+#include "sdl_utils/drawing/FrameHandoff.h"
+#include "sdl_utils/drawing/RendererProfiler.h"
 #include "sdl_utils/drawing/RendererState.h"
+#include "sdl_utils/drawing/ScreenshotEncoder.h"
+#include "sdl_utils/drawing/SharedFrameWriter.h"
+#include "sdl_utils/drawing/SoftwareTextureStore.h"
+#include "sdl_utils/drawing/StaticLayerCache.h"
+#include "sdl_utils/drawing/TiledRasterizer.h"
+#include "sdl_utils/drawing/ViewportCuller.h"
 
 // Forward declarations
 class SDLContainers;
-class Color;
+class SurfaceLoadBatch;
 struct SDL_Window;
 struct SDL_Surface;
 struct SDL_Renderer;
+struct SDL_Texture;
 
 class Renderer : public NonCopyable, public NonMoveable {
  public:
@@ -132,6 +150,27 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   void addDrawCmd_UT(const DrawParams& drawParams) const;
 
+  /** @brief bulk version of ::addDrawCmd_UT()
+   *
+   *  @param const std::span<const DrawParams> - draw specific data
+   *                                             for the widgets
+   * */
+  void addDrawCmds_UT(const std::span<const DrawParams> drawParams) const;
+
+  /** @brief used to acquire a draw recorder, which could be filled by
+   *         a worker thread in parallel with the other recorders.
+   *         The recorders are merged into the frame on ::finishFrame_UT().
+   *
+   *         NOTE: the method could be invoked from any thread.
+   *               A single recorder should be filled by a single thread.
+   *
+   *  @param const uint32_t - recorder index
+   *                          [0 - RendererConfig::drawRecordersCount)
+   *
+   *  @return DrawRecorder * - the recorder or nullptr for invalid index
+   * */
+  DrawRecorder *getDrawRecorder(const uint32_t recorderIdx);
+
   /* @brief used to store draw specific rendering commands populated by
    *                                              the main(update) thread
    *
@@ -143,6 +182,27 @@ class Renderer : public NonCopyable, public NonMoveable {
                          const uint8_t* data = nullptr,
                          const uint64_t bytes = 0);
 
+  /* @brief used to store a typed rendering command populated by
+   *                                              the main(update) thread
+   *
+   *        The payload is written directly into the renderData buffer,
+   *        followed by the optional variable sized tail
+   *        (see RendererCmdPayloads.h)
+   *
+   * @param const T &         - fixed size command payload
+   * @param const uint8_t *   - variable sized tail buffer
+   * @param const uint64_t    - tail bytes count to write
+   * */
+  template <RendererCmdPayload T>
+  void addRendererCmd_UT(const T &payload, const uint8_t* tail = nullptr,
+                         const uint64_t tailBytes = 0) {
+    addRendererCmd_UT(T::CMD, reinterpret_cast<const uint8_t*>(&payload),
+                      getRendererCmdPayloadSize<T>());
+    if (tailBytes) {
+      addRendererData_UT(tail, tailBytes);
+    }
+  }
+
   /* @brief used to store draw specific data populated by
    *                                              the main(update) thread
    *
@@ -166,6 +226,19 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   void addRendererData_UT(const uint8_t* data, const uint64_t bytes);
 
+  /* @brief used to draw the provided widgets on the current renderer
+   *        target (usually a SpriteBuffer FBO).
+   *
+   *        The widgets are transferred to the renderer thread in the
+   *        DrawParamsCodec packed format, which is several times smaller
+   *        than the raw RendererCmd::UPDATE_RENDERER_TARGET format.
+   *
+   * @param const DrawParams [] - draw specific data for the widgets
+   * @param const uint32_t      - widgets count
+   * */
+  void updateRendererTarget_UT(const DrawParams drawParamsArr[],
+                               const uint32_t size);
+
   /** @brief used to sending the main(thread) a message to exit it's
    *         render loop
    * */
@@ -187,6 +260,95 @@ class Renderer : public NonCopyable, public NonMoveable {
     return _rendererState[_updateStateIdx].lastTotalWidgetCounter;
   }
 
+  /** @brief used to acquire count for last frame culled widgets
+   *         (widgets outside of the renderer target, which were not drawn)
+   *
+   *  @returns uint32_t - culled widget count
+   * */
+  uint32_t getCulledWidgetCount_UT() const {
+    return _rendererState[_updateStateIdx].lastDrawStats.culledWidgets;
+  }
+
+  /** @brief used to acquire draw statistics for the last frame, executed
+   *         on the current renderer state
+   *
+   *  @returns const FrameDrawStats & - draw statistics
+   * */
+  const FrameDrawStats& getFrameDrawStats_UT() const {
+    return _rendererState[_updateStateIdx].lastDrawStats;
+  }
+
+  /** @brief used to acquire the update --> renderer thread pipeline
+   *         statistics (queue depth, replaced frames, etc.)
+   *
+   *         NOTE: the statistics are populated only for
+   *               RendererPolicy::MULTI_THREADED
+   *
+   *  @returns const FramePipelineStats & - pipeline statistics
+   * */
+  const FramePipelineStats& getFramePipelineStats_UT() const {
+    return _pipelineStats;
+  }
+
+  /** @brief used to acquire the widgets, renderer commands and renderer
+   *         data buffers high-water marks, so the RendererConfig could be
+   *         right-sized from production telemetry
+   *
+   *  @returns const RendererBufferStats & - buffers statistics
+   * */
+  const RendererBufferStats& getRendererBufferStats_UT() const {
+    return _bufferStats;
+  }
+
+  /** @brief used to acquire the renderer thread per RendererCmd timings.
+   *         The snapshot is lock-free and is refreshed once per frame.
+   *
+   *         NOTE: the profile is populated only when the library is built
+   *               with ENABLE_RENDERER_PROFILING
+   *
+   *  @param RendererProfile & - the last published profile
+   * */
+  void getRendererProfile_UT(RendererProfile &outProfile) const;
+
+  /** @brief starts recording the RendererCmd stream, the renderData bytes
+   *         and the widgets of the next frames into a binary file.
+   *         The capture could be re-executed offline with
+   *         ::replayFrame_UT() (see tools/frame_replay).
+   *
+   *         NOTE: the recording starts from the next frame boundary.
+   *
+   *         NOTE2: for a self-contained capture start it right after
+   *                the renderer initialisation, so the texts and FBOs
+   *                creation commands are part of it.
+   *
+   *  @param const std::string & - capture file path
+   *  @param const uint32_t      - frames to capture
+   *
+   *  @return ErrorCode          - error code
+   * */
+  ErrorCode startFrameCapture_UT(const std::string &file,
+                                 const uint32_t framesCount);
+
+  /** @brief finishes the frame capture before the requested frames count
+   *         is reached
+   * */
+  void stopFrameCapture_UT();
+
+  bool isFrameCaptureActive_UT() const {
+    return _frameCapture.isOpen();
+  }
+
+  /** @brief re-executes a frame, recorded with ::startFrameCapture_UT().
+   *         The frame is handed to the renderer as a regular one.
+   *
+   *         NOTE: texture loading of replayed frames is always performed
+   *               on the renderer thread, because the resource loading
+   *               threads are not part of the capture.
+   *
+   *  @param const CapturedFrame & - the recorded frame
+   * */
+  void replayFrame_UT(const CapturedFrame &frame);
+
   /** @brief used to unlock the currently used renderer.
    *         When the renderer is unlock - the default renderer target
    *         could be changed to some other Surface/Texture
@@ -215,19 +377,49 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   ErrorCode lockRenderer_UT();
 
-  /** @brief takes a snapshot of current renderer pixels
+  /** @brief takes a snapshot of the renderer pixels of the current frame.
+   *         The pixels are read back at the end of the frame and are
+   *         encoded and written on the screenshot encoder threads.
    *
-   *  @param const char*               - file path
-   *  @param const ScreenshotContainer - type of container [PNG, JPG, ...]
-   *  @param const int32_t             - quality (applied only for JPG)
-   *                                     range: [0, 100], worst(0) - best(100)
+   *  @param const char*                    - file path
+   *  @param const ScreenshotContainer      - type of container [PNG, JPG, ...]
+   *  @param const int32_t                  - quality (applied only for JPG)
+   *                                          range: [0, 100],
+   *                                          worst(0) - best(100)
+   *  @param const ScreenshotCompletionCb & - invoked from an encoder thread,
+   *                                          once the file is written
+   *                                          or the screenshot has failed
    *
-   *  WARNING: the renderer operation that would be performed from this call
-   *           is quite slow and should not be used in performance
-   *           critical parts of the code
+   *  NOTE: the screenshot is dropped, if RendererConfig::
+   *        maxPendingScreenshots are still being encoded
    * */
   void takeScreenshot_UT(const char *file, const ScreenshotContainer container,
-                         const int32_t quality);
+                         const int32_t quality,
+                         const ScreenshotCompletionCb &completionCb = nullptr);
+
+  /** @brief takes a screenshot on every N-th frame, until framesCount
+   *         screenshots are taken or ::stopScreenshotBurst_UT() is invoked.
+   *         The files are named <filePrefix><index>.<png/jpg>
+   *
+   *  @param const char*                    - file path prefix
+   *  @param const ScreenshotContainer      - type of container [PNG, JPG, ...]
+   *  @param const int32_t                  - quality (applied only for JPG)
+   *  @param const uint32_t                 - capture every N-th frame
+   *  @param const uint32_t                 - screenshots to take
+   *                                          (0 - until stopped)
+   *  @param const ScreenshotCompletionCb & - invoked for every screenshot
+   * */
+  void startScreenshotBurst_UT(const char *filePrefix,
+      const ScreenshotContainer container, const int32_t quality,
+      const uint32_t frameInterval, const uint32_t framesCount,
+      const ScreenshotCompletionCb &completionCb = nullptr);
+
+  void stopScreenshotBurst_UT();
+
+  /** @brief screenshots, dropped because RendererConfig::
+   *         maxPendingScreenshots were still being encoded
+   * */
+  uint64_t getDroppedScreenshotsCount_UT() const;
 
   /** @brief used to set global renderer clear color with which default
    *         renderer target is cleared once ::clearScreen() is invoked.
@@ -288,6 +480,15 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   void finishFrameExecution_RT();
 
+  /** @brief used for RendererConfig::enableUnchangedFrameSkipping.
+   *         Compares the frame with the last presented one
+   *
+   *  @param const uint32_t - widgets size
+   *
+   *  @return bool          - should the draw and the present be skipped
+   * */
+  bool isFrameUnchanged_RT(const uint32_t widgetsSize);
+
   /** @brief changes clear color for the actual hardware renderer
    * */
   void changeClearColor_RT();
@@ -300,17 +501,37 @@ class Renderer : public NonCopyable, public NonMoveable {
   /** @brief loads multiple textures (uploads the vertex data to the GPU)
    *         and free's their surfaces.
    *
-   *         NOTE: implementation uses ThreadSafeQueue.
+   *         NOTE: implementation uses SurfaceLoadBatch.
    *               the render thread is waiting on a condition variable
    *               and uploading vertex data to the GPU while waiting
    *               for new Surfaces to be generated (if there are not any)
    * */
   void loadTextureMultiple_RT();
-  void loadTextureMultipleSingleThread_RT(const std::vector<uint64_t>& rsrcIds,
+  void loadTextureMultipleSingleThread_RT(const uint64_t *rsrcIds,
                                           uint32_t itemsToPop);
-  void loadTextureMultipleMulltiThread_RT(std::vector<uint64_t>& rsrcIds,
+  void loadTextureMultipleMulltiThread_RT(SurfaceLoadBatch *surfaceBatch,
                                           uint32_t itemsToPop);
 
+  /** @brief acquires the batch, where the worker threads deliver the
+   *         surfaces of a texture loading command
+   *
+   *  @param SurfaceLoadBatch * - batch from the command payload
+   *
+   *  @return SurfaceLoadBatch * - nullptr, if the renderer thread should
+   *                               load the surfaces by itself
+   * */
+  SurfaceLoadBatch *getSurfaceLoadBatch_RT(
+      SurfaceLoadBatch *payloadBatch) const;
+
+  /** @brief waits for all surfaces of a batch, frees them and returns
+   *         the batch to the pool. Used when the load command is aborted
+   *
+   *  @param SurfaceLoadBatch * - the batch to drain
+   *  @param uint32_t           - surfaces, still to be delivered
+   * */
+  void discardSurfaceLoadBatch_RT(SurfaceLoadBatch *surfaceBatch,
+                                  uint32_t itemsToPop);
+
   /** @brief destroys a single texture (releases memory on the GPU)
    * */
   void destroyTexture_RT();
@@ -352,6 +573,16 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   void updateRendererTarget_RT();
 
+  /** @brief used to draw RendererCmd::UPDATE_RENDERER_TARGET_PACKED widgets
+   * */
+  void updateRendererTargetPacked_RT();
+
+  /** @brief culls, resolves and draws the first widgets of _fboWidgets
+   *
+   *  @param uint32_t - widgets size
+   * */
+  void drawFboWidgets_RT(uint32_t widgetsSize);
+
   /** @brief used to update the blending of the selected texture
    * */
   void changeTextureBlending_RT();
@@ -362,31 +593,145 @@ class Renderer : public NonCopyable, public NonMoveable {
 
   /** @brief loads a single text texture (makes TTF calls and uploads
    *         the vertex data to the GPU)
+   * */
+  void createTTFText_RT();
+
+  /** @brief destroys the old text texture and loads the new one
+   *         under the same TextContainer text ID
+   * */
+  void reloadTTFText_RT();
+
+  /** @brief reads the text content and creates the text texture
    *
-   *  @param const bool - is text being reloaded or created for first time
+   *  @param const CreateTTFTextPayload & - text specific data
    * */
-  void createTTFText_RT(const bool isTextBeingReloaded);
+  void loadTTFText_RT(const CreateTTFTextPayload &payload);
 
   /** @brief destroys a single texture (releases memory on the GPU)
+   * */
+  void destroyTTFText_RT();
+
+  /** @brief destroys a single text texture (releases memory on the GPU)
+   *
+   *  @param const int32_t - unique TextContainer text ID
+   * */
+  void destroyTTFTextTexture_RT(const int32_t containerId);
+
+  /** @brief reads the variable sized string tail of a command
+   *         into the frame arena
+   *
+   *  @param const uint64_t - string length (without the null character)
+   *
+   *  @return const char *  - null terminated string or nullptr on error
+   * */
+  const char *readRendererStr_RT(const uint64_t strLength);
+
+  /** @brief reads the fixed size payload of the currently executed command
+   *
+   *  @return T - command payload
+   * */
+  template <RendererCmdPayload T>
+  T readRendererCmdPayload_RT() {
+    T payload;
+    readRendererData_RT(reinterpret_cast<uint8_t*>(&payload),
+                        getRendererCmdPayloadSize<T>());
+    return payload;
+  }
+
+  /** @brief reads data from the renderData buffer of the currently
+   *         executed command
    *
-   *  @return int32_t - unique TextContainer text ID
+   *  @param uint8_t *       - outData buffer
+   *  @param const uint64_t  - bytes count to read
+   *
+   *  @return bool           - are all of the requested bytes read
+   * */
+  bool readRendererData_RT(uint8_t *outData, const uint64_t bytes);
+
+  /** @brief extracts data from the renderData buffer of the currently
+   *         executed command without copying it, when it is stored
+   *         contiguously. Otherwise the data is copied to the frame arena.
+   *
+   *  @param const uint64_t  - bytes count to extract
+   *
+   *  @return const uint8_t* - unaligned view to the data or nullptr on error.
+   *                           Valid until the end of the current command
    * */
-  int32_t destroyTTFText_RT();
+  const uint8_t *acquireRendererData_RT(const uint64_t bytes);
 
   /** @brief actual rendering of stored widgets on the current back buffer
    *
-   *  @param const std::vector<DrawParams> -
-   *                                  draw specific data for a Texture array
+   *  @param const FrameWidgets & - widgets with resolved textures
+   *  @param const uint32_t       - widgets size
    * */
-  void drawWidgetsToBackBuffer_RT(const DrawParams drawParamsArr[],
+  void drawWidgetsToBackBuffer_RT(const FrameWidgets &widgets,
                                   const uint32_t size);
 
-  /** @brief used to take a screenshot from the current renderer pixels
+  /** @brief rasterises the widgets on the CPU with the tiled rasterizer
+   *         and copies the result on the default renderer target
+   *
+   *  @param const FrameWidgets & - widgets with resolved textures
+   *  @param const uint32_t       - widgets size
+   *
+   *  @return bool                - is the frame drawn. Frames with
+   *                                unsupported widgets are not drawn
+   * */
+  bool rasterizeWidgetsToBackBuffer_RT(const FrameWidgets &widgets,
+                                       const uint32_t size);
+
+  /** @brief populates the rasterisation sources of the widgets
+   *
+   *  @param const FrameWidgets & - widgets with resolved textures
+   *  @param const uint32_t       - widgets size
+   *  @param RasterSource *       - sources, indexed as the widgets
+   *
+   *  @return bool                - are all of the widgets supported
+   * */
+  bool populateRasterSources_RT(const FrameWidgets &widgets,
+                                const uint32_t size,
+                                RasterSource *outSources);
+
+  /** @brief used to populate the texture column of the widgets
+   *
+   *  @param FrameWidgets &  - widgets to resolve
+   *  @param const uint32_t  - widgets size
+   * */
+  void resolveWidgetTextures_RT(FrameWidgets &widgets,
+                                const uint32_t widgetsSize) const;
+
+  /** @brief draws a single widget with Texture::draw()
+   *
+   *  @param SDL_Texture *      - widget texture
+   *  @param const DrawParams & - draw specific data for a single Widget
+   * */
+  void drawWidget_RT(SDL_Texture *texture, const DrawParams &drawParams);
+
+  /** @brief used to request a screenshot of the current frame
    * */
   void takeScreenshot_RT();
 
-  /** @brief used to update the state of the multithreading texture
-   *                                                     loading strategy
+  /** @brief reads back the renderer pixels for the requested screenshots
+   *         and hands them to the screenshot encoder
+   * */
+  void captureScreenshots_RT();
+
+  /** @brief reads back the renderer pixels directly into the shared
+   *         memory frame ring, if a consumer is attached
+   * */
+  void exportSharedFrame_RT();
+
+  /** @brief takes the next screenshot of the active screenshot burst
+   * */
+  void updateScreenshotBurst_UT();
+
+  /** @brief appends the recorded widgets of the draw recorders to
+   *         the frame in ascending sort key order and clears the recorders
+   * */
+  void mergeDrawRecorders_UT();
+
+  /** @brief consumes the multithreading texture loading strategy change.
+   *         The texture loading commands carry their SurfaceLoadBatch,
+   *         so the renderer thread does not track the strategy itself
    * */
   void enableDisableMultithreadTextureLoading_RT();
 
@@ -397,6 +742,34 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   void applyGlobalOffsets_RT(const uint32_t widgetsSize);
 
+  /** @brief used to reorder the currently stored for the frame widgets
+   *         in order to reduce the texture switches
+   *
+   *  @param const uint32_t - widgets size
+   * */
+  void reorderWidgets_RT(const uint32_t widgetsSize);
+
+  /** @brief used to remove the widgets, which are outside of the current
+   *         renderer target viewport
+   *
+   *  @param FrameWidgets &  - widgets to cull
+   *  @param const uint32_t  - widgets size
+   *
+   *  @return uint32_t       - visible widgets count
+   * */
+  uint32_t cullWidgets_RT(FrameWidgets &widgets, const uint32_t widgetsSize);
+
+  /** @brief used to render the stable widget runs into the static layer
+   *         FBOs and to replace them with a single draw of their FBO
+   *
+   *  @param FrameWidgets &  - widgets with resolved textures
+   *  @param const uint32_t  - widgets size
+   *
+   *  @return uint32_t       - widgets count after the replacement
+   * */
+  uint32_t applyStaticLayers_RT(FrameWidgets &widgets,
+                                const uint32_t widgetsSize);
+
   /** @brief used by either resource or update thread to execute accumulated
    *         rendering commands
    *
@@ -407,11 +780,35 @@ class Renderer : public NonCopyable, public NonMoveable {
    * */
   bool executeRenderCommandsInternal();
 
+  /** @brief used in FramePresentMode::MAILBOX to replace the newest pending
+   *         frame, instead of waiting for the renderer thread to release
+   *         a RendererState
+   *
+   *  @returns bool - is the pending frame replaced
+   * */
+  bool tryReplacePendingFrame_UT();
+
+  /** @brief updates the buffers high-water marks with the populated frame
+   * */
+  void updateBufferStats_UT();
+
+  /** @brief grows the buffers of the fresh update renderer state to the
+   *         high-water marks
+   * */
+  void reserveBuffers_UT();
+
+  using RendererCmdHandler = void (Renderer::*)();
+
+  /** Indexed by RendererCmd value. Replaces the big switch dispatch.
+   *
+   *  NOTE: RendererCmd::EXIT_RENDERING_LOOP has no handler, because it
+   *        terminates the execution of the commands
+   **/
+  static const RendererCmdHandler CMD_HANDLERS[RENDERER_CMDS_COUNT];
+
   // NOTE: @_RT - render thread interface
   //================== END RENDER THREAD INTERFACE ======================
 
-  enum InternalDefines { SUPPORTED_BACK_BUFFERS = 2 };
-
   // The window we'll be rendering to
   SDL_Window* _window;
 
@@ -431,18 +828,9 @@ class Renderer : public NonCopyable, public NonMoveable {
   /** used for synchronisation mechanism between update(secondary) and
    *                                              renderer(main) thread
    *
-   *      Direction: update thread --> renderer thread
-   **/
-  std::mutex _updateMutex;
-  std::condition_variable _updateCondVar;
-
-  /** used for synchronisation mechanism between update(secondary) and
-   *                                              renderer(main) thread
-   *
-   *      Direction: renderer thread --> update thread
+   *  Applied only for RendererPolicy::MULTI_THREADED
    **/
-  std::mutex _renderMutex;
-  std::condition_variable _renderCondVar;
+  FrameHandoff _frameHandoff;
 
   /* Used to store RendererState for the current state.
    *
@@ -452,45 +840,165 @@ class Renderer : public NonCopyable, public NonMoveable {
    * The update(main) thread works on frame N,
    * while the renderer(secondary) threads works on frame N - 1.
    *
-   * The lock time will be as much as swapping the two
-   * RendererState pointers (double-buffering like approach).
+   * The lock time will be as much as handing the RendererState index
+   * to the other thread (double-buffering like approach).
    *
-   * After the swap the update(main) thread will continue to populate
+   * After the handoff the update(main) thread will continue to populate
    * the new fresh frame, while the renderer(secondary) thread will draw
    * the previous frame.
    *
-   * NOTE: For now 2 RendererStates are kept simultaneously. If later on
-   * triple buffering is needed -> this number can be increased here
-   * from 2 to 3.
+   * NOTE: RendererPolicy::SINGLE_THREADED always uses 2 RendererStates.
+   *       RendererPolicy::MULTI_THREADED uses RendererConfig::pipelineDepth
+   *       RendererStates (triple buffering and beyond), which allows the
+   *       update thread to run up to (pipelineDepth - 1) frames ahead.
    */
-  mutable RendererState _rendererState[SUPPORTED_BACK_BUFFERS];
+  mutable RendererState _rendererState[MAX_RENDERER_PIPELINE_DEPTH];
+
+  FramePipelineStats _pipelineStats;
+
+  /** Accessed only by the update thread.
+   *  Mutable, because ::addDrawCmd_UT() is const
+   **/
+  mutable RendererBufferStats _bufferStats;
+
+  /** Allocated only when ENABLE_RENDERER_PROFILING is turned on
+   *
+   *  Written by the renderer thread, read by the update thread
+   **/
+  std::unique_ptr<RendererProfiler> _profiler;
+
+  /** used for ::startFrameCapture_UT()
+   *
+   *  Accessed only by the update thread
+   **/
+  FrameCaptureWriter _frameCapture;
+
+  FramePresentMode _presentMode = FramePresentMode::FIFO;
 
   RendererPolicy _executionPolicy = RendererPolicy::MULTI_THREADED;
 
-  /** a synchronization flag used to determine whether the renderer
-   *  thread is busy.
+  DrawBackend _drawBackend = DrawBackend::RENDER_COPY;
+
+  /** used to clear the default renderer target
+   *
+   *  Accessed only by the renderer thread
+   **/
+  Color _clearColor = Colors::BLACK;
+
+  /** used to hold the widgets of RendererCmd::UPDATE_RENDERER_TARGET
+   *
+   *  Accessed only by the renderer thread
+   **/
+  FrameWidgets _fboWidgets;
+
+  /** scratch buffer for RendererCmd::UPDATE_RENDERER_TARGET_PACKED
+   *  encoding
+   *
+   *  Accessed only by the update thread
+   **/
+  std::vector<uint8_t> _updatePackedWidgets;
+
+  /** used for DrawBackend::BATCHED_GEOMETRY
+   *
+   *  Accessed only by the renderer thread
+   **/
+  DrawBatcher _drawBatcher;
+
+  /** used for RendererConfig::enableDrawReordering
+   *
+   *  Accessed only by the renderer thread
+   **/
+  DrawReorderer _drawReorderer;
+  bool _isDrawReorderingEnabled = false;
+
+  /** used for RendererConfig::enableViewportCulling
+   *
+   *  Accessed only by the renderer thread
+   **/
+  ViewportCuller _viewportCuller;
+  uint32_t _frameCulledWidgets = 0;
+  bool _isViewportCullingEnabled = false;
+
+  /** used for RendererConfig::enableUnchangedFrameSkipping
+   *
+   *  Accessed only by the renderer thread
+   **/
+  uint64_t _lastPresentedFrameHash = 0;
+  uint64_t _skippedFrames = 0;
+  uint32_t _framesSincePresent = 0;
+  uint32_t _forcedPresentInterval = 0;
+  bool _frameHasStateChanges = true;
+  bool _isFrameSkippingEnabled = false;
+
+  /** used for RendererConfig::enableStaticLayerCaching
+   *
+   *  Accessed only by the renderer thread
+   **/
+  StaticLayerCache _staticLayerCache;
+  uint64_t _staticLayerRenders = 0;
+  bool _hasImageTextureChanges = false;
+  bool _isStaticLayerCachingEnabled = false;
+
+  /** used for DrawBackend::TILED_SOFTWARE
+   *
+   *  Accessed only by the renderer thread
+   **/
+  TiledRasterizer _tiledRasterizer;
+  SoftwareTextureStore _softwareTextures;
+  std::vector<uint32_t> _tiledScreenPixels;
+  SDL_Texture *_tiledScreenTexture = nullptr;
+  int32_t _tiledScreenWidth = 0;
+  int32_t _tiledScreenHeight = 0;
+
+  /** Encodes and writes the screenshots on background threads
+   **/
+  ScreenshotEncoder _screenshotEncoder;
+
+  /** Screenshots, requested in the current frame.
+   *  Read back after the frame is drawn.
    *
-   *  Direction: renderer thread --> update thread
+   *  Accessed only by the renderer thread
    **/
-  bool _isRendererBusy;
-
-  /* used to mark the state of the renderer
-   * This is needed to prevent deadlocks from the update thread
-   * when renderer has already been shut downed*/
-  bool _isShutdowned;
-
-  /** a flag to determine whether multithreading texture loading is used.
-   *     > If TRUE -> other threads are responsible for loading the
-   *       images from harddrive to raw pixel data (SDL_Surface) and
-   *       the renderer thread is only responsible for uploading the
-   *                      vertex data to the GPU (creating SDL_Texture).
-   *
-   *     > If FALSE -> the renderer thread is responsible for both
-   *       loading the images from harddrive to raw pixel data
-   *       (SDL_Surface) and uploading the vertex data to the GPU
-   *                                             (creating SDL_Texture).
+  struct ScreenshotRequest {
+    std::string file;
+    ScreenshotContainer container = ScreenshotContainer::PNG;
+    int32_t quality = 0;
+    uint64_t screenshotId = 0;
+  };
+  std::vector<ScreenshotRequest> _screenshotRequests;
+
+  /** used for ::startScreenshotBurst_UT()
+   *
+   *  Accessed only by the update thread
+   **/
+  struct ScreenshotBurst {
+    std::string filePrefix;
+    ScreenshotCompletionCb completionCb;
+    ScreenshotContainer container = ScreenshotContainer::PNG;
+    int32_t quality = 0;
+    uint32_t frameInterval = 1;
+    uint32_t framesLeft = 0;
+    uint32_t framesSinceCapture = 0;
+    uint32_t capturedCount = 0;
+    bool isActive = false;
+  };
+  ScreenshotBurst _screenshotBurst;
+
+  /** used for ::getDrawRecorder()
+   *
+   *  The recorders are filled by the worker threads and merged
+   *  by the update thread
+   **/
+  std::unique_ptr<DrawRecorder[]> _drawRecorders;
+  uint32_t _drawRecordersCount = 0;
+  std::vector<uint32_t> _drawRecordersMergeOrder;
+
+  /** used for RendererConfig::enableSharedFrameExport
+   *
+   *  Accessed only by the renderer thread
    **/
-  bool _isMultithreadTextureLoadingEnabled;
+  SharedFrameWriter _sharedFrameWriter;
+  bool _hasReportedSharedFrameOverflow = false;
 };
 
 #endif /* SDL_UTILS_RENDERER_H_ */
@@ -0,0 +1,121 @@
+#ifndef SDL_UTILS_RENDERERPROFILER_H_
+#define SDL_UTILS_RENDERERPROFILER_H_
+
+// System headers
+#include <atomic>
+#include <cstdint>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+
+// Forward declarations
+
+/** Log-linear (HDR style) duration histogram.
+ *
+ *  Every power of 2 range of nanoseconds is split into SUB_BUCKETS_COUNT
+ *  linear buckets, so the relative error of a single bucket is at most 25%
+ *  in the whole [1ns, 2^MAX_DURATION_BITS ns) range. Bigger durations are
+ *  accumulated in the last bucket.
+ * */
+struct RendererTimingHistogram {
+  enum InternalDefines : uint32_t {
+    SUB_BUCKET_BITS = 2,
+    SUB_BUCKETS_COUNT = 1 << SUB_BUCKET_BITS,
+
+    // ~68 seconds
+    MAX_DURATION_BITS = 36,
+    BUCKETS_COUNT = (MAX_DURATION_BITS - SUB_BUCKET_BITS + 1) *
+                    SUB_BUCKETS_COUNT
+  };
+
+  static uint32_t getBucketIdx(const uint64_t durationNs);
+
+  /** @brief smallest duration, which falls in the bucket
+   * */
+  static uint64_t getBucketLowerBoundNs(const uint32_t bucketIdx);
+
+  void record(const uint64_t durationNs) {
+    ++buckets[getBucketIdx(durationNs)];
+  }
+
+  /** @brief evaluates the requested percentile (with bucket precision)
+   *
+   *  @param const double - percentile in range [0, 100]
+   *
+   *  @return uint64_t    - lower bound of the bucket holding the percentile
+   * */
+  uint64_t getPercentileNs(const double percentile) const;
+
+  uint64_t buckets[BUCKETS_COUNT] { };
+};
+
+struct RendererCmdProfile {
+  uint64_t count = 0;
+  uint64_t totalNs = 0;
+  uint64_t maxNs = 0;
+  RendererTimingHistogram histogram;
+};
+
+struct RendererProfile {
+  // indexed by RendererCmd value
+  RendererCmdProfile cmds[RENDERER_CMDS_COUNT];
+
+  // executed batches of renderer commands (usually a single frame each)
+  uint64_t frames = 0;
+  uint64_t lastFrameNs = 0;
+  uint32_t lastFrameCmds = 0;
+  uint64_t maxFrameNs = 0;
+  RendererTimingHistogram frameHistogram;
+
+  // false, when the profiling is compiled out (ENABLE_RENDERER_PROFILING 0)
+  bool isEnabled = false;
+};
+
+/** Accumulates the renderer thread timings and publishes them once per
+ *  frame through a lock-free triple buffer, so the update thread could
+ *  acquire a consistent snapshot at any time without blocking either
+ *  thread.
+ * */
+class RendererProfiler : public NonCopyable, public NonMoveable {
+ public:
+  static uint64_t nowNs();
+
+  void recordCmd_RT(const RendererCmd cmd, const uint64_t durationNs);
+
+  /** @brief records the frame totals and publishes the accumulated profile
+   * */
+  void recordFrame_RT(const uint32_t cmdsCount, const uint64_t durationNs);
+
+  /** @brief acquires the last published profile
+   *
+   *         NOTE: a single consumer thread is supported
+   * */
+  void getSnapshot_UT(RendererProfile &outProfile) const;
+
+ private:
+  enum InternalDefines : uint8_t {
+    BUFFERS_COUNT = 3,
+    BUFFER_IDX_MASK = 0x3,
+    HAS_NEW_DATA = 0x4
+  };
+
+  // written only by the renderer thread
+  RendererProfile _accumulated;
+
+  RendererProfile _buffers[BUFFERS_COUNT];
+
+  // index of the buffer, owned by the renderer thread
+  uint8_t _backIdx = 0;
+
+  // index of the buffer, owned by the update thread
+  mutable uint8_t _frontIdx = 1;
+
+  // index of the buffer, which is exchanged between the threads
+  alignas(CACHE_LINE_SIZE) mutable std::atomic<uint8_t> _middle { 2 };
+};
+
+#endif /* SDL_UTILS_RENDERERPROFILER_H_ */
@@ -6,12 +6,13 @@
 #include <vector>
 
 // Other libraries headers
-#include "utils/common/CircularBuffer.h"
 #include "utils/ErrorCode.h"
 
 // Own components headers
 #include "sdl_utils/drawing/defines/RendererDefines.h"
-#include "sdl_utils/drawing/DrawParams.h"
+#include "sdl_utils/drawing/FrameArena.h"
+#include "sdl_utils/drawing/FrameWidgets.h"
+#include "sdl_utils/drawing/RenderDataBuffer.h"
 
 // Forward declarations
 struct RendererConfig;
@@ -19,6 +20,23 @@ struct RendererConfig;
 struct RendererState {
   ErrorCode init(const RendererConfig &cfg);
 
+  /** @brief drops all stored commands, data and widgets for the frame
+   * */
+  void discardFrame();
+
+  /** @brief grows the widgets storage. The stored widgets are preserved
+   *
+   *  @param const uint32_t - new widgets capacity
+   * */
+  void growWidgets(const uint32_t capacity);
+
+  /** @brief grows the renderer commands storage.
+   *         The stored commands are preserved
+   *
+   *  @param const uint32_t - new renderer commands capacity
+   * */
+  void growRendererCmds(const uint32_t capacity);
+
   /** Holds stored number of widgets for the current frame
    * */
   uint32_t currWidgetCounter = 0;
@@ -32,7 +50,13 @@ struct RendererState {
    * */
   uint32_t lastTotalWidgetCounter = 0;
 
-  /** Holds widgets.size() and rendererCmd.size()
+  /** Draw statistics for the last frame executed on this state.
+   *  Populated by the renderer thread.
+   * */
+  FrameDrawStats lastDrawStats;
+
+  /** Holds widgets.capacity() and rendererCmd.size().
+   *  Start from the RendererConfig values and grow on demand
    * */
   uint32_t maxRuntimeWidgets = 0;
   uint32_t maxRuntimeRendererCmds = 0;
@@ -45,11 +69,11 @@ struct RendererState {
    * Since rendering will be the most heavy operation we need to prepare
    * draw specific data in the most comfortable way.
    *
-   * An array is chosen here, so we can guarantee that we will have
-   * 0(1) lookup time and constant cache hits, because of the
-   * sequential memory layout
+   * Structure of arrays is chosen here, so every render thread pass
+   * (global offsets, culling, reordering, batching) streams only through
+   * the columns it actually needs
    * */
-  std::vector<DrawParams> widgets;
+  FrameWidgets widgets;
 
   /* Used to store draw specific rendering commands populated by
    * the main(update) thread
@@ -59,7 +83,13 @@ struct RendererState {
   /** A buffer that holds all draw specific data populated by
    *  the main(update) thread
    **/
-  CircularBuffer renderData;
+  RenderDataBuffer renderData;
+
+  /** Holds the transient renderer thread allocations of the commands
+   *  (texts, file names, resource ids, widget batches).
+   *  Reset by the renderer thread at the end of the frame.
+   **/
+  FrameArena frameArena;
 
   /** Used to determine whether the render is locked or not.
    *     > If Renderer is locked - the default renderer target is used;
@@ -68,6 +98,19 @@ struct RendererState {
    *                                     (usually owned by SpriteBuffer);
    * */
   bool isLocked = true;
+
+  /** Set when a command with persistent side effects (anything other than
+   *  CLEAR_SCREEN or FINISH_FRAME) is stored for the current frame.
+   *  Such frames can not be replaced in FramePresentMode::MAILBOX.
+   *
+   *  NOTE: accessed only by the update thread
+   * */
+  bool hasPersistentCmds = false;
+
+  /** Set for the frames, populated by Renderer::replayFrame_UT().
+   *  Reset by the renderer thread, once the frame is executed.
+   * */
+  bool isReplayedFrame = false;
 };
 
 #endif //SDL_UTILS_RENDERERSTATE_H_
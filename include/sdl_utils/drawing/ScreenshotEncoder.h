@@ -0,0 +1,142 @@
+#ifndef SDL_UTILS_SCREENSHOTENCODER_H_
+#define SDL_UTILS_SCREENSHOTENCODER_H_
+
+// System headers
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+#include "sdl_utils/drawing/defines/DrawUtilityDefines.h"
+
+// Forward declarations
+
+/** Renderer pixels, read back for a single screenshot
+ * */
+struct ScreenshotJob {
+  // 32 bit ARGB pixels with pitch = width * 4. Taken from the buffer pool
+  std::vector<uint8_t> pixels;
+  int32_t width = 0;
+  int32_t height = 0;
+
+  std::string file;
+  ScreenshotContainer container = ScreenshotContainer::PNG;
+  int32_t quality = 0;
+  uint64_t screenshotId = 0;
+
+  // the screenshot could not be taken - only its completion is reported
+  bool isCancelled = false;
+};
+
+/** Encodes and writes the screenshots on a pool of background threads,
+ *  so the renderer thread only reads the pixels back.
+ *
+ *  The pixel buffers are pooled. At most maxPendingScreenshots buffers are
+ *  in flight - further screenshots are dropped until an encoding finishes.
+ *
+ *  The completion callbacks are registered by the update thread and are
+ *  invoked from the encoder threads.
+ * */
+class ScreenshotEncoder : public NonCopyable, public NonMoveable {
+ public:
+  ~ScreenshotEncoder();
+
+  /** @brief used to initialise the screenshot encoder
+   *
+   *  @param const uint32_t - number of encoder threads
+   *  @param const uint32_t - max screenshots, which are read back, but
+   *                          still not written
+   *
+   *  @return ErrorCode     - error code
+   * */
+  ErrorCode init(const uint32_t threadsCount,
+                 const uint32_t maxPendingScreenshots);
+
+  /** @brief writes the pending screenshots and joins the encoder threads
+   * */
+  void deinit();
+
+  /** @brief assigns an id to a new screenshot request
+   *
+   *  @param const ScreenshotCompletionCb & - invoked, once the screenshot
+   *                                          is written or dropped
+   *                                          (could be empty)
+   *
+   *  @return uint64_t                      - the screenshot id
+   * */
+  uint64_t registerScreenshot(const ScreenshotCompletionCb &completionCb);
+
+  /** @brief takes a pixel buffer from the pool
+   *
+   *  @param const uint64_t         - buffer size in bytes
+   *  @param std::vector<uint8_t> & - the acquired buffer
+   *
+   *  @return bool                  - false, if maxPendingScreenshots
+   *                                  buffers are already in flight
+   * */
+  bool tryAcquireBuffer(const uint64_t bytes, std::vector<uint8_t> &outBuffer);
+
+  /** @brief hands the screenshot to the encoder threads
+   * */
+  void submit(ScreenshotJob &&job);
+
+  /** @brief completes a screenshot, which could not be taken.
+   *         The completion callback is invoked from an encoder thread
+   *
+   *  @param const uint64_t         - the screenshot id
+   *  @param const char *           - the screenshot file
+   *  @param std::vector<uint8_t> & - the acquired buffer (could be empty)
+   * */
+  void cancel(const uint64_t screenshotId, const char *file,
+              std::vector<uint8_t> &buffer);
+
+  /** @brief cancels a screenshot, which was not read back at all and
+   *         counts it in getDroppedScreenshotsCount()
+   *
+   *  @param const uint64_t - the screenshot id
+   *  @param const char *   - the screenshot file
+   * */
+  void drop(const uint64_t screenshotId, const char *file);
+
+  uint64_t getDroppedScreenshotsCount() const;
+
+ private:
+  void workerLoop();
+
+  static ErrorCode encode(const ScreenshotJob &job);
+
+  void complete(const uint64_t screenshotId, const char *file,
+                const ErrorCode err);
+
+  void releaseBuffer(std::vector<uint8_t> &buffer);
+
+  std::vector<std::thread> _workers;
+
+  std::mutex _jobsMutex;
+  std::condition_variable _jobsCv;
+  std::deque<ScreenshotJob> _jobs;
+  bool _isShutdown = false;
+
+  mutable std::mutex _buffersMutex;
+  std::vector<std::vector<uint8_t>> _freeBuffers;
+  uint32_t _buffersInFlight = 0;
+  uint32_t _maxPendingScreenshots = 0;
+  uint64_t _droppedScreenshots = 0;
+
+  std::mutex _callbacksMutex;
+  std::unordered_map<uint64_t, ScreenshotCompletionCb> _completionCbs;
+  uint64_t _nextScreenshotId = 1;
+};
+
+#endif /* SDL_UTILS_SCREENSHOTENCODER_H_ */
@@ -0,0 +1,83 @@
+#ifndef SDL_UTILS_SHAREDFRAMEREADER_H_
+#define SDL_UTILS_SHAREDFRAMEREADER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/SharedFrameDefines.h"
+
+// Forward declarations
+
+/** Zero-copy view to a frame in the shared memory ring.
+ *  The pixels are valid only while ::isValid() returns true.
+ * */
+struct SharedFrameView {
+  const uint8_t *pixels = nullptr;
+  uint64_t frameSequence = 0;
+  int64_t timestampNs = 0;
+  int32_t width = 0;
+  int32_t height = 0;
+  int32_t pitch = 0;
+
+  const SharedFrameSlotHeader *slot = nullptr;
+  uint64_t lockSequence = 0;
+};
+
+/** Consumer side of the shared memory frame ring, published by
+ *  SharedFrameWriter. Meant to be used by other processes
+ *  (recorders, streamers).
+ *
+ *  Usage:
+ *    reader.acquireLatestFrame(view);
+ *    process(view.pixels);
+ *    if (!reader.isValid(view)) { discard the result }
+ *
+ *  The reader should acquire frames at least once per
+ *  SHARED_FRAME_CONSUMER_TIMEOUT_NS, otherwise the renderer considers it
+ *  gone and stops the readback (::heartbeat() could be used as well).
+ * */
+class SharedFrameReader : public NonCopyable, public NonMoveable {
+ public:
+  ~SharedFrameReader() noexcept;
+
+  /** @brief maps the shared memory object and registers as a consumer
+   *
+   *  @param const std::string & - shared memory object name ("/name")
+   *
+   *  @return ErrorCode          - error code
+   * */
+  ErrorCode open(const std::string &name);
+
+  void close();
+
+  /** @brief acquires the newest published frame
+   *
+   *  @param SharedFrameView & - the frame view
+   *
+   *  @return bool             - false, if no frame is published yet or
+   *                             the frame is being overwritten
+   * */
+  bool acquireLatestFrame(SharedFrameView &outView);
+
+  /** @brief checks, that the frame was not overwritten while it was used
+   * */
+  bool isValid(const SharedFrameView &view) const;
+
+  /** @brief keeps the consumer registration alive
+   * */
+  void heartbeat();
+
+ private:
+  uint8_t *_memory = nullptr;
+  uint64_t _memoryBytes = 0;
+  SharedFrameRingHeader *_header = nullptr;
+};
+
+#endif /* SDL_UTILS_SHAREDFRAMEREADER_H_ */
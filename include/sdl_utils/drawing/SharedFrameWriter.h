@@ -0,0 +1,92 @@
+#ifndef SDL_UTILS_SHAREDFRAMEWRITER_H_
+#define SDL_UTILS_SHAREDFRAMEWRITER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/SharedFrameDefines.h"
+
+// Forward declarations
+
+/** Publishes the rendered frames into a ring of frames in POSIX shared
+ *  memory (see SharedFrameDefines.h for the layout). The frames are
+ *  consumed by other processes with SharedFrameReader.
+ *
+ *  Used only by the renderer thread. Not supported on Emscripten and on
+ *  platforms without POSIX shared memory.
+ * */
+class SharedFrameWriter : public NonCopyable, public NonMoveable {
+ public:
+  ~SharedFrameWriter() noexcept;
+
+  /** @brief creates the shared memory object.
+   *         A stale object with the same name is replaced.
+   *
+   *  @param const std::string & - shared memory object name ("/name")
+   *  @param const uint32_t      - frames in the ring
+   *  @param const int32_t       - max frame width
+   *  @param const int32_t       - max frame height
+   *
+   *  @return ErrorCode          - error code
+   * */
+  ErrorCode open(const std::string &name, const uint32_t slotsCount,
+                 const int32_t maxWidth, const int32_t maxHeight);
+
+  /** @brief unmaps and removes the shared memory object
+   * */
+  void close();
+
+  bool isOpen() const {
+    return nullptr != _header;
+  }
+
+  /** @brief is any consumer attached and alive
+   * */
+  bool hasConsumers() const;
+
+  /** @brief locks the next ring slot for writing
+   *
+   *  @param const int32_t - frame width
+   *  @param const int32_t - frame height
+   *
+   *  @return uint8_t *    - the slot pixels (pitch = width * 4) or
+   *                         nullptr, if the frame does not fit in a slot
+   * */
+  uint8_t *beginFrame(const int32_t width, const int32_t height);
+
+  /** @brief publishes the slot, locked by ::beginFrame()
+   * */
+  void publishFrame();
+
+  /** @brief releases the slot, locked by ::beginFrame(), without
+   *         publishing it (the readback has failed)
+   * */
+  void abortFrame();
+
+  uint64_t getPublishedFramesCount() const {
+    return _frameSequence;
+  }
+
+ private:
+  SharedFrameSlotHeader *getSlot(const uint64_t frameSequence) const;
+
+  std::string _name;
+  uint8_t *_memory = nullptr;
+  uint64_t _memoryBytes = 0;
+  SharedFrameRingHeader *_header = nullptr;
+
+  //sequence of the last published frame
+  uint64_t _frameSequence = 0;
+
+  //the slot, locked by ::beginFrame()
+  SharedFrameSlotHeader *_writtenSlot = nullptr;
+};
+
+#endif /* SDL_UTILS_SHAREDFRAMEWRITER_H_ */
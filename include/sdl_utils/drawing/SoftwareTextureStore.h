@@ -0,0 +1,69 @@
+#ifndef SDL_UTILS_SOFTWARETEXTURESTORE_H_
+#define SDL_UTILS_SOFTWARETEXTURESTORE_H_
+
+// System headers
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct SDL_Renderer;
+struct SDL_Texture;
+
+/** CPU copy of a SDL_Texture content in 32 bit ARGB (0xAARRGGBB)
+ * */
+struct SoftwareTexture {
+  std::vector<uint32_t> pixels;
+  int32_t width = 0;
+  int32_t height = 0;
+};
+
+/** Keeps CPU copies of the textures, drawn by the tiled software
+ *  rasteriser. The copies are read back from the renderer on first use.
+ *
+ *  Only textures with immutable content (images and texts) should be
+ *  acquired. The copy must be forgotten before the texture is destroyed,
+ *  because SDL could reuse it's address for a new texture.
+ * */
+class SoftwareTextureStore : public NonCopyable, public NonMoveable {
+ public:
+  void init(SDL_Renderer *renderer) {
+    _renderer = renderer;
+  }
+
+  /** @brief returns the CPU copy of the texture.
+   *         Reads the texture back on the first request.
+   *
+   *         NOTE: changes the renderer target. It should be restored
+   *               by the caller.
+   *
+   *  @param SDL_Texture *            - the texture
+   *
+   *  @return const SoftwareTexture * - the CPU copy or nullptr on failure
+   * */
+  const SoftwareTexture *acquire(SDL_Texture *texture);
+
+  void forget(SDL_Texture *texture) {
+    _textures.erase(texture);
+  }
+
+  void clear() {
+    _textures.clear();
+  }
+
+ private:
+  ErrorCode readTexture(SDL_Texture *texture, SoftwareTexture &outTexture);
+
+  SDL_Renderer *_renderer = nullptr;
+
+  std::unordered_map<SDL_Texture*, SoftwareTexture> _textures;
+};
+
+#endif /* SDL_UTILS_SOFTWARETEXTURESTORE_H_ */
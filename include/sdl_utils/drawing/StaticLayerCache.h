@@ -0,0 +1,149 @@
+#ifndef SDL_UTILS_STATICLAYERCACHE_H_
+#define SDL_UTILS_STATICLAYERCACHE_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct FrameWidgets;
+struct SDL_Texture;
+
+/** A run of consecutive widgets, rendered once into a FBO
+ * */
+struct StaticLayer {
+  // the layer FBO. Sized as the renderer viewport
+  SDL_Texture *texture = nullptr;
+  int32_t width = 0;
+  int32_t height = 0;
+
+  // rows of the frame widgets, covered by the layer
+  uint32_t startIdx = 0;
+  uint32_t widgetsCount = 0;
+
+  bool isValid = false;
+
+  // the rows changed their content (or the layer is new)
+  bool needsRender = false;
+};
+
+/** Detects runs of IMAGE widgets, which stayed identical for several
+ *  consecutive frames (static backgrounds). Such a run is rendered once
+ *  into an internally managed FBO and is replaced by a single draw of
+ *  that FBO, until any of its widgets changes.
+ *
+ *  The widgets are compared by index. Inserting or removing a widget in
+ *  front of a run changes all of its rows.
+ *
+ *  The FBOs are drawn with premultiplied alpha blending, so translucent
+ *  widgets are composed in the same way as if they were drawn directly.
+ *  Renderers, which do not support custom blend modes, disable the cache.
+ * */
+class StaticLayerCache : public NonCopyable, public NonMoveable {
+ public:
+  static constexpr uint32_t MAX_LAYERS = 4;
+
+  /** @brief used to initialise the static layer cache
+   *
+   *  @param const uint32_t - max number of widgets in a single frame
+   *  @param const uint32_t - consecutive frames, for which a widget
+   *                          should stay unchanged to be cached
+   *  @param const uint32_t - min number of widgets in a cached layer
+   *
+   *  @return ErrorCode     - error code
+   * */
+  ErrorCode init(const uint32_t maxWidgets, const uint32_t stableFrames,
+                 const uint32_t minLayerWidgets);
+
+  /** @brief releases the layer FBOs.
+   *         Must be invoked before the SDL_Renderer is destroyed
+   * */
+  void deinit();
+
+  /** @brief compares the widgets with the previous frame, invalidates the
+   *         changed layers and creates layers for the new stable runs
+   *
+   *  @param const FrameWidgets & - widgets with resolved textures
+   *  @param const uint32_t       - widgets count
+   * */
+  void update(const FrameWidgets &widgets, const uint32_t size);
+
+  /** @brief invalidates all of the layers.
+   *         Used when the content of the image textures has changed
+   * */
+  void invalidate();
+
+  /** @brief validates the widgets of a layer and prepares it's FBO
+   *         for rendering
+   *
+   *  @param const uint32_t       - layer index
+   *  @param const FrameWidgets & - widgets with resolved textures
+   *  @param const int32_t        - renderer viewport width
+   *  @param const int32_t        - renderer viewport height
+   *
+   *  @return SDL_Texture *       - the FBO to render the layer widgets into
+   *                                or nullptr, if the layer can not be cached
+   * */
+  SDL_Texture *beginLayerRender(const uint32_t layerIdx,
+                                const FrameWidgets &widgets,
+                                const int32_t viewportWidth,
+                                const int32_t viewportHeight);
+
+  /** @brief marks the layer as rendered
+   *
+   *  @param const uint32_t - layer index
+   * */
+  void finishLayerRender(const uint32_t layerIdx);
+
+  /** @brief replaces the rows of the rendered layers with a single row,
+   *         drawing the layer FBO. The order of the rest rows is preserved.
+   *
+   *  @param FrameWidgets &  - widgets with resolved textures
+   *  @param const uint32_t  - widgets count
+   *
+   *  @return uint32_t       - widgets count after the replacement
+   * */
+  uint32_t substitute(FrameWidgets &widgets, const uint32_t size) const;
+
+  const StaticLayer &getLayer(const uint32_t layerIdx) const {
+    return _layers[layerIdx];
+  }
+
+  bool isSupported() const {
+    return _isSupported;
+  }
+
+ private:
+  void resize(const uint32_t size);
+
+  /** @brief is the row a candidate for a new layer
+   * */
+  bool isRowCacheable(const FrameWidgets &widgets, const uint32_t idx) const;
+
+  /** @brief can the row texture be composed through a premultiplied FBO
+   * */
+  bool hasSupportedBlending(const FrameWidgets &widgets,
+                            const uint32_t idx) const;
+
+  StaticLayer _layers[MAX_LAYERS];
+
+  // per row data of the previous frames
+  std::vector<uint64_t> _rowHashes;
+  std::vector<uint32_t> _unchangedFrames;
+  std::vector<uint8_t> _isRejected;
+  uint32_t _prevSize = 0;
+
+  uint32_t _stableFrames = 0;
+  uint32_t _minLayerWidgets = 0;
+
+  bool _isSupported = true;
+};
+
+#endif /* SDL_UTILS_STATICLAYERCACHE_H_ */
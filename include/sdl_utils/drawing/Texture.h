@@ -9,6 +9,7 @@
 // Own components headers
 #include "sdl_utils/drawing/defines/RendererDefines.h"
 #include "sdl_utils/drawing/defines/DrawConstants.h"
+#include "sdl_utils/drawing/RenderStateCache.h"
 #include "utils/ErrorCode.h"
 
 // Forward declarations
@@ -107,7 +108,9 @@ public:
                                       SDL_Surface *&outSurface);
 
   /** @brief used to clear (wipe out) current renderer target with
-   *         currently set draw color for the main renderer
+   *         the provided color
+   *
+   *         NOTE: the color is left as the renderer draw color
    *
    *         WARNING: use this method only if you know what you are doing!
    *
@@ -152,6 +155,22 @@ public:
    * */
   static void draw(SDL_Texture *texture, const DrawParams &drawParams);
 
+  /** @brief used to reset the renderer clip rectangle, left by the last
+   *         cropped ::draw(), before making other SDL draw calls
+   *         (for example SDL_RenderGeometry())
+   * */
+  static void resetClipRect();
+
+  /** @brief used to acquire the renderer state changes (target, draw color,
+   *         clip rectangle, texture alpha and blend modulation), which
+   *         were filtered out, because they would not change the state
+   *
+   *  @return uint32_t - avoided SDL calls since the last reset
+   * */
+  static uint32_t getAvoidedStateChangesCount();
+
+  static void resetAvoidedStateChangesCount();
+
   /** @brief used to acquire renderer pointer that will be performing
    *                                         the graphical render calls.
    *
@@ -223,6 +242,11 @@ private:
   static SDL_Renderer *_renderer;
 
   static Rectangle _monitorRect;
+
+  /** Shadows the renderer state, so redundant SDL calls are filtered out.
+   *  The monitor rectangle is used as the default clip rectangle
+   * */
+  static RenderStateCache _stateCache;
 };
 
 #endif /* SDL_UTILS_TEXTURE_H_ */
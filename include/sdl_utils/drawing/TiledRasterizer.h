@@ -0,0 +1,185 @@
+#ifndef SDL_UTILS_TILEDRASTERIZER_H_
+#define SDL_UTILS_TILEDRASTERIZER_H_
+
+// System headers
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+
+// Forward declarations
+struct FrameWidgets;
+
+/** CPU accessible 32 bit ARGB pixels (0xAARRGGBB)
+ * */
+struct RasterSurface {
+  uint32_t *pixels = nullptr;
+  int32_t width = 0;
+  int32_t height = 0;
+
+  // in pixels
+  int32_t pitch = 0;
+};
+
+/** Per widget source of the rasterisation
+ * */
+struct RasterSource {
+  const uint32_t *pixels = nullptr;
+  int32_t width = 0;
+  int32_t height = 0;
+
+  // in pixels
+  int32_t pitch = 0;
+
+  uint8_t alphaMod = FULL_OPACITY;
+
+  // only BlendMode::NONE and BlendMode::BLEND are supported
+  BlendMode blendMode = BlendMode::BLEND;
+};
+
+/** Software rasteriser, which splits the target surface into square tiles,
+ *  bins the widgets by the tiles, they touch, and rasterises the tiles in
+ *  parallel on a worker pool.
+ *
+ *  Every tile is rasterised by a single thread with the widgets in their
+ *  submission order, and the per pixel math does not depend on the tile
+ *  boundaries. The output is bit-exact for any number of threads and any
+ *  tile size.
+ *
+ *  Supported widgets: crop, scaling (nearest neighbour), flip, alpha
+ *  modulation and BlendMode::NONE/BLEND. Rotated widgets are not supported
+ *  (see ::isWidgetSupported()).
+ *
+ *  Blending (straight alpha, rounded with exact division by 255):
+ *    a   = srcA * alphaMod / 255
+ *    dst = src * a / 255 + dst * (255 - a) / 255 (the alpha channel is
+ *                                                 blended with src = 255)
+ *  The blend spans use SSE2, when available, with a bit-exact scalar
+ *  fallback.
+ * */
+class TiledRasterizer : public NonCopyable, public NonMoveable {
+ public:
+  static constexpr int32_t DEFAULT_TILE_SIZE = 64;
+
+  ~TiledRasterizer();
+
+  /** @brief used to initialise the tiled rasterizer
+   *
+   *  @param const uint32_t - threads to rasterise with (including the
+   *                          calling one). 0 - hardware concurrency
+   *  @param const int32_t  - tile side in pixels
+   *
+   *  @return ErrorCode     - error code
+   * */
+  ErrorCode init(const uint32_t threadsCount, const int32_t tileSize);
+
+  /** @brief joins the worker threads
+   * */
+  void deinit();
+
+  /** @brief can the widget be rasterised
+   *
+   *  @param const FrameWidgets & - widgets of the frame
+   *  @param const uint32_t       - row of the widget
+   *  @param const RasterSource & - the widget source
+   * */
+  static bool isWidgetSupported(const FrameWidgets &widgets,
+                                const uint32_t idx,
+                                const RasterSource &source);
+
+  /** @brief clears the target and rasterises the widgets on it
+   *
+   *  @param const FrameWidgets & - widgets of the frame
+   *  @param const uint32_t       - widgets count
+   *  @param const RasterSource * - sources, indexed as the widgets
+   *  @param const uint32_t       - clear color (0xAARRGGBB)
+   *  @param const RasterSurface & - the target
+   * */
+  void rasterize(const FrameWidgets &widgets, const uint32_t size,
+                 const RasterSource *sources, const uint32_t clearColor,
+                 const RasterSurface &target);
+
+  uint32_t getThreadsCount() const {
+    return static_cast<uint32_t>(_workers.size()) + 1;
+  }
+
+ private:
+  /** The per pixel mapping of a widget destination quad
+   *  to it's source rectangle
+   * */
+  struct WidgetSpan {
+    // visible part of the destination quad, clipped by the target
+    int32_t minX = 0;
+    int32_t minY = 0;
+    int32_t maxX = 0;
+    int32_t maxY = 0;
+
+    // destination quad
+    int32_t quadX = 0;
+    int32_t quadY = 0;
+    int32_t quadW = 0;
+    int32_t quadH = 0;
+
+    // source rectangle
+    int32_t srcX = 0;
+    int32_t srcY = 0;
+    int32_t srcW = 0;
+    int32_t srcH = 0;
+
+    bool isFlippedX = false;
+    bool isFlippedY = false;
+  };
+
+  void binWidgets(const FrameWidgets &widgets, const uint32_t size);
+
+  void workerLoop();
+
+  /** @brief rasterises tiles, until all of the frame tiles are taken
+   *
+   *  @param std::vector<uint32_t> & - thread scratch row
+   * */
+  void rasterizeTiles(std::vector<uint32_t> &scratchRow);
+
+  void rasterizeTile(const uint32_t tileIdx,
+                     std::vector<uint32_t> &scratchRow) const;
+
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _startCv;
+  std::condition_variable _doneCv;
+  uint64_t _frameGeneration = 0;
+  uint32_t _busyWorkers = 0;
+  bool _isShutdown = false;
+
+  // the next tile to be rasterised
+  std::atomic<uint32_t> _nextTile { 0 };
+
+  int32_t _tileSize = DEFAULT_TILE_SIZE;
+  int32_t _tilesX = 0;
+  int32_t _tilesY = 0;
+
+  // widget indices, binned per tile. Reused between the frames
+  std::vector<std::vector<uint32_t>> _tileWidgets;
+
+  std::vector<WidgetSpan> _spans;
+
+  // scratch row of the calling thread
+  std::vector<uint32_t> _scratchRow;
+
+  // frame data, valid during ::rasterize()
+  const RasterSource *_sources = nullptr;
+  RasterSurface _target;
+  uint32_t _clearColor = 0;
+};
+
+#endif /* SDL_UTILS_TILEDRASTERIZER_H_ */
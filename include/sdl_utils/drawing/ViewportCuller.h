@@ -0,0 +1,64 @@
+#ifndef SDL_UTILS_VIEWPORTCULLER_H_
+#define SDL_UTILS_VIEWPORTCULLER_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/drawing/Rectangle.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct FrameWidgets;
+
+/** Rejects widgets, whose draw boundary (crop, scaling and rotation taken
+ *  into account) does not intersect the viewport of the current renderer
+ *  target (the monitor or a FBO).
+ *
+ *  The draw boundaries are evaluated from the widgets hot columns into
+ *  separate min/max coordinate arrays, so the intersection test could be run with SIMD
+ *  (AVX2 or SSE2, depending on the target architecture, with a scalar
+ *  fallback).
+ * */
+class ViewportCuller : public NonCopyable, public NonMoveable {
+ public:
+  /** @brief used to initialise the viewport culler
+   *
+   *  @param const uint32_t - max number of widgets in a single frame
+   *
+   *  @return ErrorCode     - error code
+   * */
+  ErrorCode init(const uint32_t maxWidgets);
+
+  /** @brief removes the invisible widgets. The order of the visible
+   *         widgets is preserved.
+   *
+   *  @param FrameWidgets &     - widgets to cull
+   *  @param const uint32_t     - widgets count
+   *  @param const Rectangle &  - viewport of the current renderer target
+   *
+   *  @return uint32_t          - visible widgets count
+   * */
+  uint32_t cull(FrameWidgets &widgets, const uint32_t size,
+                const Rectangle &viewport);
+
+ private:
+  void resize(const uint32_t size);
+
+  void evaluateVisibility(const uint32_t size, const Rectangle &viewport);
+
+  // draw boundaries in [min, max) format
+  std::vector<int32_t> _minX;
+  std::vector<int32_t> _minY;
+  std::vector<int32_t> _maxX;
+  std::vector<int32_t> _maxY;
+
+  std::vector<uint8_t> _isVisible;
+};
+
+#endif /* SDL_UTILS_VIEWPORTCULLER_H_ */
@@ -16,14 +16,115 @@ struct SDL_Renderer;
 struct RendererConfig {
   SDL_Window *window = nullptr;
   RendererPolicy executionPolicy = RendererPolicy::MULTI_THREADED;
+
+  /** Synchronisation mechanism used to hand frames between the update
+   *  and the renderer thread. Applied only for MULTI_THREADED policy.
+   **/
+  FrameHandoffPolicy frameHandoffPolicy =
+      FrameHandoffPolicy::CONDITION_VARIABLE;
+
+  /** Number of RendererState's in the update --> renderer thread pipeline.
+   *  Supported range: [MIN_RENDERER_PIPELINE_DEPTH,
+   *                    MAX_RENDERER_PIPELINE_DEPTH]
+   *
+   *  A deeper pipeline absorbs render thread hiccups at the cost
+   *  of increased input to display latency.
+   *  Applied only for MULTI_THREADED policy.
+   **/
+  uint32_t pipelineDepth = MIN_RENDERER_PIPELINE_DEPTH;
+
+  /** Behaviour of the update thread when all pipeline RendererState's
+   *  are in flight. FramePresentMode::MAILBOX requires pipelineDepth >= 3
+   *  in order to have a replaceable pending frame while the renderer thread
+   *  is busy with another one. Applied only for MULTI_THREADED policy.
+   **/
+  FramePresentMode presentMode = FramePresentMode::FIFO;
+
+  /** The way stored widgets are submitted to the hardware renderer.
+   *  DrawBackend::RENDER_COPY is kept as a reference implementation.
+   **/
+  DrawBackend drawBackend = DrawBackend::RENDER_COPY;
+
+  /** Threads (including the renderer one), used by
+   *  DrawBackend::TILED_SOFTWARE. 0 - hardware concurrency
+   **/
+  uint32_t tiledRasterThreads = 0;
+
+  // tile side in pixels for DrawBackend::TILED_SOFTWARE
+  int32_t tiledRasterTileSize = 64;
+
+  /** Skip the widgets that are completely outside of the current renderer
+   *  target (the monitor or a FBO) on the renderer thread.
+   **/
+  bool enableViewportCulling = false;
+
+  /** Reorder non-overlapping widgets of the frame on the renderer thread,
+   *  so widgets sharing the same texture are drawn consecutively.
+   *  The final image is not changed.
+   **/
+  bool enableDrawReordering = false;
+
+  /** Skip the draw and the present of the frames, identical to the last
+   *  presented one (same widgets, global offsets and no state changing
+   *  renderer commands). Useful for static screens.
+   **/
+  bool enableUnchangedFrameSkipping = false;
+
+  /** Present at least every N-th frame, even if the frames are unchanged.
+   *  Applied only with enableUnchangedFrameSkipping. 0 - never force
+   **/
+  uint32_t forcedPresentInterval = 60;
+
+  /** Render runs of IMAGE widgets, which stayed unchanged for
+   *  staticLayerStableFrames consecutive frames, once into an internally
+   *  managed FBO and draw that single FBO instead, until any of the
+   *  widgets changes. Useful for static backgrounds, composed of many
+   *  widgets. Up to StaticLayerCache::MAX_LAYERS viewport sized FBOs are
+   *  allocated.
+   **/
+  bool enableStaticLayerCaching = false;
+  uint32_t staticLayerStableFrames = 30;
+
+  // shorter runs of unchanged widgets are drawn directly
+  uint32_t staticLayerMinWidgets = 64;
+
+  /** Screenshots are read back on the renderer thread and are encoded
+   *  and written on screenshotEncoderThreads background threads.
+   *  Up to maxPendingScreenshots screen sized pixel buffers are allocated.
+   *  Further screenshots are dropped, while all of them are in use.
+   **/
+  uint32_t screenshotEncoderThreads = 1;
+  uint32_t maxPendingScreenshots = 4;
+
+  /** Publish every presented frame into a ring of sharedFrameExportSlots
+   *  frames in the sharedFrameExportName POSIX shared memory object, where
+   *  out-of-process consumers (recorders, streamers) map them with
+   *  SharedFrameReader. The frames are read back only while a consumer
+   *  is attached. Not supported on Emscripten.
+   *  The object name must be unique between the running processes -
+   *  only a ring, left by a crashed writer, is taken over.
+   **/
+  bool enableSharedFrameExport = false;
+  const char *sharedFrameExportName = "/sdl_utils_frames";
+  uint32_t sharedFrameExportSlots = 3;
+
   RendererScaleQuality scaleQuality = RendererScaleQuality::LINEAR;
   RendererFlagsMask flagsMask = 0;
 
+  /** Initial per frame capacities. The buffers grow on demand, so
+   *  the values could be right-sized from
+   *  Renderer::getRendererBufferStats_UT() high-water marks
+   **/
   uint32_t maxRuntimeWidgets = 0;
   uint32_t maxRuntimeRendererCommands = 0;
 
+  /** Draw recorders, which could be filled in parallel by worker threads
+   *  (see Renderer::getDrawRecorder()). 0 - disabled
+   **/
+  uint32_t drawRecordersCount = 0;
+
   /** A buffer that holds all draw specific data populated by
-   *  the main(update) thread
+   *  the main(update) thread. Grows with chunks of this size
    **/
   uint64_t maxRendererBackBufferDataSize = 0;
 };
@@ -41,6 +41,17 @@ enum class ScreenshotContainer : uint8_t {
   PNG, JPG
 };
 
+/** Dense handle of a registered image resource
+ *  (see ResourceContainer::getRsrcHandle()).
+ *  The low bits hold the texture slot index,
+ *  the high bits - the generation of the issuing container.
+ * */
+using RsrcHandle = uint32_t;
+constexpr RsrcHandle INVALID_RSRC_HANDLE = 0;
+constexpr uint32_t RSRC_HANDLE_INDEX_BITS = 24;
+constexpr uint32_t RSRC_HANDLE_INDEX_MASK =
+    (1u << RSRC_HANDLE_INDEX_BITS) - 1;
+
 constexpr int32_t ZERO_OPACITY = 0;
 constexpr int32_t FULL_OPACITY = 255;
 
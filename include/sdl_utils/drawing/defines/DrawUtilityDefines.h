@@ -6,6 +6,7 @@
 #include <functional>
 
 //Other libraries headers
+#include "utils/ErrorCode.h"
 
 //Own components headers
 #include "sdl_utils/drawing/defines/DrawConstants.h"
@@ -13,4 +14,8 @@
 using TakeScreenshotCb = std::function<void(const char *file,
     const ScreenshotContainer container, const int32_t quality)>;
 
+//invoked, once the screenshot is written to the file (or has failed)
+using ScreenshotCompletionCb = std::function<void(const char *file,
+    const ErrorCode err)>;
+
 #endif /* SDL_UTILS_DRAWUTILITYDEFINES_H_ */
@@ -0,0 +1,70 @@
+#ifndef SDL_UTILS_FRAMECAPTUREDEFINES_H_
+#define SDL_UTILS_FRAMECAPTUREDEFINES_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "sdl_utils/drawing/DrawParams.h"
+
+// Forward declarations
+
+/* Frame capture file layout (host byte order):
+ *
+ * FrameCaptureHeader:
+ *   char[8]  magic ("SDLUCAP")
+ *   uint32_t version
+ *   uint32_t framesCount
+ *   int32_t  windowWidth
+ *   int32_t  windowHeight
+ *   uint32_t maxFrameWidgets
+ *   uint32_t maxFrameRendererCmds
+ *   uint64_t maxFrameDataBytes
+ *
+ * followed by framesCount frame records:
+ *   uint32_t    rendererCmdsCount
+ *   uint32_t    widgetsCount
+ *   uint64_t    renderDataBytes
+ *   uint64_t    encodedWidgetsBytes
+ *   int32_t     globalOffsetX
+ *   int32_t     globalOffsetY
+ *   uint8_t     isLocked
+ *   RendererCmd rendererCmds[rendererCmdsCount]
+ *   uint8_t     renderData[renderDataBytes]
+ *   uint8_t     encodedWidgets[encodedWidgetsBytes] (DrawParamsCodec format)
+ * */
+constexpr char FRAME_CAPTURE_MAGIC[8] = "SDLUCAP";
+constexpr uint32_t FRAME_CAPTURE_VERSION = 4;
+
+struct FrameCaptureHeader {
+  uint32_t version = FRAME_CAPTURE_VERSION;
+  uint32_t framesCount = 0;
+
+  //size of the captured window. Used to recreate the same renderer target
+  int32_t windowWidth = 0;
+  int32_t windowHeight = 0;
+
+  //peak values of the captured frames. Used to size the replay renderer
+  uint32_t maxFrameWidgets = 0;
+  uint32_t maxFrameRendererCmds = 0;
+  uint64_t maxFrameDataBytes = 0;
+};
+
+struct CapturedFrame {
+  std::vector<RendererCmd> rendererCmds;
+
+  //the renderData bytes in the order, in which they were written
+  std::vector<uint8_t> renderData;
+
+  std::vector<DrawParams> widgets;
+
+  int32_t globalOffsetX = 0;
+  int32_t globalOffsetY = 0;
+  bool isLocked = true;
+};
+
+#endif /* SDL_UTILS_FRAMECAPTUREDEFINES_H_ */
@@ -0,0 +1,214 @@
+#ifndef SDL_UTILS_RENDERERCMDPAYLOADS_H_
+#define SDL_UTILS_RENDERERCMDPAYLOADS_H_
+
+// System headers
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+// Other libraries headers
+#include "utils/drawing/Color.h"
+
+// Own components headers
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+
+// Forward declarations
+class SurfaceLoadBatch;
+
+/* Fixed size part of the renderData, written for every RendererCmd.
+ *
+ * The structs are byte packed, so their layout is identical to the
+ * field by field serialisation, used by the external writers of
+ * Renderer::addRendererCmd_UT(const RendererCmd, const uint8_t*, ...).
+ *
+ * The variable sized data (texts, file paths, resource ids, widgets)
+ * follows the fixed size part and is documented for every payload.
+ * */
+
+template <typename T>
+concept RendererCmdPayload = std::is_trivially_copyable_v<T> &&
+    requires { { T::CMD } -> std::convertible_to<RendererCmd>; };
+
+/** @brief bytes written in the renderData for the fixed size payload
+ * */
+template <RendererCmdPayload T>
+constexpr uint64_t getRendererCmdPayloadSize() {
+  return std::is_empty_v<T> ? 0 : sizeof(T);
+}
+
+#pragma pack(push, 1)
+
+struct ClearScreenPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CLEAR_SCREEN;
+};
+
+struct FinishFramePayload {
+  static constexpr RendererCmd CMD = RendererCmd::FINISH_FRAME;
+  bool overrideRendererLockCheck = false;
+};
+static_assert(sizeof(FinishFramePayload) == sizeof(bool));
+
+struct ChangeClearColorPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CHANGE_CLEAR_COLOR;
+  Color clearColor = Colors::BLACK;
+};
+static_assert(sizeof(ChangeClearColorPayload) == sizeof(Color));
+
+// surfaceBatch - where the worker threads deliver the decoded surfaces.
+// nullptr, when the renderer thread decodes them by itself
+struct LoadTextureSinglePayload {
+  static constexpr RendererCmd CMD = RendererCmd::LOAD_TEXTURE_SINGLE;
+  uint64_t rsrcId = 0;
+  SurfaceLoadBatch *surfaceBatch = nullptr;
+};
+static_assert(sizeof(LoadTextureSinglePayload) ==
+              sizeof(uint64_t) + sizeof(SurfaceLoadBatch*));
+
+// followed by uint64_t rsrcIds[itemsCount]
+struct LoadTextureMultiplePayload {
+  static constexpr RendererCmd CMD = RendererCmd::LOAD_TEXTURE_MULTIPLE;
+  uint32_t itemsCount = 0;
+  int32_t batchId = 0;
+  SurfaceLoadBatch *surfaceBatch = nullptr;
+};
+static_assert(sizeof(LoadTextureMultiplePayload) ==
+              sizeof(uint32_t) + sizeof(int32_t) + sizeof(SurfaceLoadBatch*));
+
+struct DestroyTexturePayload {
+  static constexpr RendererCmd CMD = RendererCmd::DESTROY_TEXTURE;
+  uint64_t rsrcId = 0;
+};
+static_assert(sizeof(DestroyTexturePayload) == sizeof(uint64_t));
+
+struct CreateFboPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CREATE_FBO;
+  int32_t width = 0;
+  int32_t height = 0;
+  int32_t containerId = 0;
+};
+static_assert(sizeof(CreateFboPayload) == 3 * sizeof(int32_t));
+
+struct DestroyFboPayload {
+  static constexpr RendererCmd CMD = RendererCmd::DESTROY_FBO;
+  int32_t containerId = 0;
+};
+static_assert(sizeof(DestroyFboPayload) == sizeof(int32_t));
+
+struct ChangeRendererTargetPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CHANGE_RENDERER_TARGET;
+  int32_t containerId = 0;
+};
+static_assert(sizeof(ChangeRendererTargetPayload) == sizeof(int32_t));
+
+struct ResetRendererTargetPayload {
+  static constexpr RendererCmd CMD = RendererCmd::RESET_RENDERER_TARGET;
+};
+
+struct ClearRendererTargetPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CLEAR_RENDERER_TARGET;
+  Color clearColor = Colors::BLACK;
+};
+static_assert(sizeof(ClearRendererTargetPayload) == sizeof(Color));
+
+// followed by DrawParams widgets[itemsCount]
+struct UpdateRendererTargetPayload {
+  static constexpr RendererCmd CMD = RendererCmd::UPDATE_RENDERER_TARGET;
+  uint32_t itemsCount = 0;
+};
+static_assert(sizeof(UpdateRendererTargetPayload) == sizeof(uint32_t));
+
+// followed by uint8_t encodedWidgets[encodedBytes] (DrawParamsCodec format)
+struct UpdateRendererTargetPackedPayload {
+  static constexpr RendererCmd CMD =
+      RendererCmd::UPDATE_RENDERER_TARGET_PACKED;
+  uint32_t itemsCount = 0;
+  uint64_t encodedBytes = 0;
+};
+static_assert(sizeof(UpdateRendererTargetPackedPayload) ==
+              sizeof(uint32_t) + sizeof(uint64_t));
+
+// followed by ChangeTextureBlendModeImagePayload for WidgetType::IMAGE
+// or ChangeTextureBlendModeContainerPayload for the other widget types
+struct ChangeTextureBlendModePayload {
+  static constexpr RendererCmd CMD = RendererCmd::CHANGE_TEXTURE_BLENDMODE;
+  WidgetType widgetType = WidgetType::UNKNOWN;
+  BlendMode blendMode = BlendMode::NONE;
+};
+static_assert(sizeof(ChangeTextureBlendModePayload) ==
+              sizeof(WidgetType) + sizeof(BlendMode));
+
+struct ChangeTextureBlendModeImagePayload {
+  static constexpr RendererCmd CMD = RendererCmd::CHANGE_TEXTURE_BLENDMODE;
+  uint64_t rsrcId = 0;
+};
+static_assert(sizeof(ChangeTextureBlendModeImagePayload) == sizeof(uint64_t));
+
+struct ChangeTextureBlendModeContainerPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CHANGE_TEXTURE_BLENDMODE;
+  int32_t containerId = 0;
+};
+static_assert(sizeof(ChangeTextureBlendModeContainerPayload) ==
+              sizeof(int32_t));
+
+struct ChangeTextureOpacityPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CHANGE_TEXTURE_OPACITY;
+  WidgetType widgetType = WidgetType::UNKNOWN;
+  int32_t opacity = 0;
+  int32_t containerId = 0;
+};
+static_assert(sizeof(ChangeTextureOpacityPayload) ==
+              sizeof(WidgetType) + 2 * sizeof(int32_t));
+
+// followed by char text[textLength] (not null terminated)
+struct CreateTTFTextPayload {
+  static constexpr RendererCmd CMD = RendererCmd::CREATE_TTF_TEXT;
+  int32_t containerId = 0;
+  uint64_t fontId = 0;
+  Color textColor = Colors::BLACK;
+  uint64_t textLength = 0;
+};
+static_assert(sizeof(CreateTTFTextPayload) ==
+              sizeof(int32_t) + 2 * sizeof(uint64_t) + sizeof(Color));
+
+// same layout as CreateTTFTextPayload. The containerId is reused
+struct ReloadTTFTextPayload : CreateTTFTextPayload {
+  static constexpr RendererCmd CMD = RendererCmd::RELOAD_TTF_TEXT;
+};
+static_assert(sizeof(ReloadTTFTextPayload) == sizeof(CreateTTFTextPayload));
+
+struct DestroyTTFTextPayload {
+  static constexpr RendererCmd CMD = RendererCmd::DESTROY_TTF_TEXT;
+  int32_t containerId = 0;
+};
+static_assert(sizeof(DestroyTTFTextPayload) == sizeof(int32_t));
+
+struct EnableDisableMultithreadTextureLoadingPayload {
+  static constexpr RendererCmd CMD =
+      RendererCmd::ENABLE_DISABLE_MULTITHREAD_TEXTURE_LOADING;
+  bool isEnabled = false;
+};
+static_assert(sizeof(EnableDisableMultithreadTextureLoadingPayload) ==
+              sizeof(bool));
+
+// followed by char file[fileLength] (not null terminated)
+struct TakeScreenshotPayload {
+  static constexpr RendererCmd CMD = RendererCmd::TAKE_SCREENSHOT;
+  ScreenshotContainer container = ScreenshotContainer::PNG;
+  int32_t quality = 0;
+  uint64_t fileLength = 0;
+
+  // the ScreenshotEncoder id of the request
+  uint64_t screenshotId = 0;
+};
+static_assert(sizeof(TakeScreenshotPayload) ==
+              sizeof(ScreenshotContainer) + sizeof(int32_t) +
+              sizeof(uint64_t) + sizeof(uint64_t));
+
+struct ExitRenderingLoopPayload {
+  static constexpr RendererCmd CMD = RendererCmd::EXIT_RENDERING_LOOP;
+};
+
+#pragma pack(pop)
+
+#endif /* SDL_UTILS_RENDERERCMDPAYLOADS_H_ */
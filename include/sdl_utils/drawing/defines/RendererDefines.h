@@ -41,6 +41,24 @@
  * */
 #define DISABLE_DOUBLE_BUFFERING_SWAP_INTERVAL 0
 
+/* Values:
+ *
+ * ENABLE_RENDERER_PROFILING 1
+ * Every executed RendererCmd is timed on the renderer thread. Per command
+ * counts, durations and histograms together with per frame totals could be
+ * acquired with Renderer::getRendererProfile_UT().
+ *
+ * ENABLE_RENDERER_PROFILING 0
+ * The instrumentation is compiled out. Renderer::getRendererProfile_UT()
+ * returns an empty profile.
+ *
+ * NOTE: could be overridden from the build system
+ *       (SDL_UTILS_ENABLE_RENDERER_PROFILING CMake option).
+ * */
+#ifndef ENABLE_RENDERER_PROFILING
+#define ENABLE_RENDERER_PROFILING 0
+#endif /* ENABLE_RENDERER_PROFILING */
+
 enum class RendererPolicy {
   //execute rendering commands as part of the main (update thread)
   SINGLE_THREADED,
@@ -50,6 +68,129 @@ enum class RendererPolicy {
   MULTI_THREADED
 };
 
+enum class FrameHandoffPolicy : uint8_t {
+  //two mutexes and two condition variables
+  CONDITION_VARIABLE,
+
+  //atomic counters with short spinning before parking the waiting thread
+  LOCK_FREE
+};
+
+enum class FramePresentMode : uint8_t {
+  //every published frame is rendered. The update thread blocks when all
+  //renderer states are in flight
+  FIFO,
+
+  //when all renderer states are in flight the newest pending frame (still
+  //not picked up by the renderer thread) is replaced by the new one instead
+  //of blocking the update thread.
+  //NOTE: frames holding commands with persistent side effects
+  //      (texture/FBO/text operations, screenshots, etc.) are never replaced
+  MAILBOX
+};
+
+/** Size of a single cache line on the supported platforms.
+ *  std::hardware_destructive_interference_size is not used, because
+ *  it is not ABI stable across compiler versions.
+ * */
+constexpr uint32_t CACHE_LINE_SIZE = 64;
+
+//number of RendererState's used for RendererPolicy::MULTI_THREADED
+constexpr uint32_t MIN_RENDERER_PIPELINE_DEPTH = 2;
+constexpr uint32_t MAX_RENDERER_PIPELINE_DEPTH = 4;
+
+struct FramePipelineStats {
+  //frames handed to the renderer thread and still not released by it,
+  //sampled at the last handoff (including the frame being handed)
+  uint32_t framesInFlight = 0;
+
+  //peak of framesInFlight
+  uint32_t maxFramesInFlight = 0;
+
+  //total frames handed to the renderer thread
+  uint64_t publishedFrames = 0;
+
+  //frames replaced by a newer one in FramePresentMode::MAILBOX
+  uint64_t replacedFrames = 0;
+};
+
+enum class DrawBackend : uint8_t {
+  //one SDL_RenderCopyEx() call per widget
+  RENDER_COPY,
+
+  //consecutive widgets sharing the same texture are submitted with a single
+  //SDL_RenderGeometry() call (requires SDL 2.0.18 or newer)
+  BATCHED_GEOMETRY,
+
+  //the frame is rasterised on the CPU in parallel tiles and uploaded with
+  //a single texture copy (requires RendererFlag::SOFTARE_RENDERER).
+  //Frames with unsupported widgets are drawn with RENDER_COPY
+  TILED_SOFTWARE
+};
+
+struct FrameDrawStats {
+  //texture switches in the order, in which the widgets were submitted
+  uint32_t textureSwitchesBeforeReorder = 0;
+
+  //texture switches after the draw reordering pass
+  uint32_t textureSwitchesAfterReorder = 0;
+
+  //widgets outside of the renderer target viewport, which were not drawn
+  //(including the widgets from FBO updates)
+  uint32_t culledWidgets = 0;
+
+  //heap allocations, made by the renderer thread frame arena.
+  //Stays 0 once the arena has grown to the frame high-water mark
+  uint32_t arenaHeapAllocations = 0;
+
+  //transient renderer thread bytes, served by the frame arena
+  uint64_t arenaUsedBytes = 0;
+
+  //total frames, whose draw and present were skipped, because they were
+  //identical to the last presented one (RendererConfig::
+  //enableUnchangedFrameSkipping)
+  uint64_t skippedFrames = 0;
+
+  //static layer FBOs, drawn in the frame (RendererConfig::
+  //enableStaticLayerCaching)
+  uint32_t staticLayers = 0;
+
+  //widgets, replaced by the static layer FBOs in the frame
+  uint32_t staticLayerWidgets = 0;
+
+  //total renders of widgets into the static layer FBOs
+  uint64_t staticLayerRenders = 0;
+
+  //SDL renderer state changes (render target, draw color, clip rectangle,
+  //texture alpha and blend modulation), filtered out in the frame,
+  //because they would not change the state
+  uint32_t avoidedStateChanges = 0;
+
+  //total frames, published to the shared memory frame ring
+  //(RendererConfig::enableSharedFrameExport)
+  uint64_t sharedFramesExported = 0;
+};
+
+/** Renderer buffers usage telemetry, used to right-size
+ *  the RendererConfig maxRuntime... values.
+ *  The high-water marks are the biggest single frame usage.
+ *  The capacities are the current per RendererState capacities.
+ * */
+struct RendererBufferStats {
+  uint32_t widgetsHighWater = 0;
+  uint32_t widgetsCapacity = 0;
+
+  uint32_t rendererCmdsHighWater = 0;
+  uint32_t rendererCmdsCapacity = 0;
+
+  uint64_t renderDataHighWater = 0;
+  uint64_t renderDataCapacity = 0;
+
+  //buffer growths in the middle of a frame (the frame was bigger than
+  //all of the previous frames). Should stay 0 for a right-sized config
+  uint32_t midFrameGrowths = 0;
+};
+
 enum class RendererScaleQuality {
   NEAREST, // Nearest pixel sampling
   LINEAR,  // Linear filtering (supported by OpenGL and Direct3D)
@@ -79,6 +220,7 @@ enum class RendererCmd : uint8_t {
   RESET_RENDERER_TARGET,
   CLEAR_RENDERER_TARGET,
   UPDATE_RENDERER_TARGET,
+  UPDATE_RENDERER_TARGET_PACKED, // DrawParamsCodec encoded widgets
   CHANGE_TEXTURE_BLENDMODE,
   CHANGE_TEXTURE_OPACITY,
   CREATE_TTF_TEXT,
@@ -91,10 +233,15 @@ enum class RendererCmd : uint8_t {
   UNDEFINED = 255
 };
 
+constexpr uint32_t RENDERER_CMDS_COUNT =
+    static_cast<uint32_t>(RendererCmd::EXIT_RENDERING_LOOP) + 1;
+
 RendererFlagsMask valiteRendererFlagsMask(const RendererFlagsMask mask);
 
 RendererPolicy valiteRendererExecutionPolicy(const RendererPolicy policy);
 
 std::string getRendererPolicyName(RendererPolicy policy);
 
+const char* getRendererCmdName(const RendererCmd cmd);
+
 #endif /* SDL_UTILS_RENDERERDEFINES_H_ */
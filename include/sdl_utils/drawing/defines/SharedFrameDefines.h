@@ -0,0 +1,102 @@
+#ifndef SDL_UTILS_SHAREDFRAMEDEFINES_H_
+#define SDL_UTILS_SHAREDFRAMEDEFINES_H_
+
+// System headers
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+
+// Forward declarations
+
+/* Shared memory frame ring layout (host byte order):
+ *
+ * SharedFrameRingHeader
+ * followed by slotsCount slots, each one slotStride bytes:
+ *   SharedFrameSlotHeader
+ *   uint8_t pixels[slotPixelsCapacity] (32 bit ARGB, 0xAARRGGBB)
+ *
+ * Every slot is guarded by a sequence lock. The slot sequence is odd,
+ * while the renderer thread writes the slot, and is 2 * frameSequence,
+ * once the frame is published. A reader maps the pixels in place and
+ * validates, that the slot sequence has not changed after it is done with
+ * them. With N slots the reader has N - 1 frames to consume a frame,
+ * before it is overwritten.
+ *
+ * The renderer reads the frames back only while a consumer is attached -
+ * consumersCount is not 0 and a consumer heartbeat is received in the
+ * last SHARED_FRAME_CONSUMER_TIMEOUT_NS.
+ * */
+#if !defined(__EMSCRIPTEN__) && (defined(__unix__) || defined(__APPLE__))
+#define SHARED_FRAME_EXPORT_SUPPORTED 1
+#else
+#define SHARED_FRAME_EXPORT_SUPPORTED 0
+#endif
+
+constexpr uint32_t SHARED_FRAME_MAGIC = 0x53554652; // "SUFR"
+constexpr uint32_t SHARED_FRAME_VERSION = 2;
+
+// CLOCK_MONOTONIC nanoseconds
+constexpr int64_t SHARED_FRAME_CONSUMER_TIMEOUT_NS = 1000000000;
+
+//steady_clock is CLOCK_MONOTONIC, so it is comparable between processes
+inline int64_t getSharedFrameClockNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "The shared frame ring requires lock-free 64 bit atomics");
+
+struct alignas(CACHE_LINE_SIZE) SharedFrameRingHeader {
+  uint32_t magic = SHARED_FRAME_MAGIC;
+  uint32_t version = SHARED_FRAME_VERSION;
+  uint32_t slotsCount = 0;
+
+  //max frame size, the slots could hold
+  int32_t maxWidth = 0;
+  int32_t maxHeight = 0;
+
+  uint64_t slotPixelsCapacity = 0;
+  uint64_t slotStride = 0;
+
+  //process id of the writer. Used to detect rings of crashed writers
+  int32_t writerPid = 0;
+
+  //frame sequence of the newest published frame (0 - none)
+  std::atomic<uint64_t> latestSequence { 0 };
+
+  //updated by the consumers
+  std::atomic<uint32_t> consumersCount { 0 };
+  std::atomic<int64_t> consumerHeartbeatNs { 0 };
+};
+
+struct alignas(CACHE_LINE_SIZE) SharedFrameSlotHeader {
+  //sequence lock (see the layout description)
+  std::atomic<uint64_t> lockSequence { 0 };
+
+  uint64_t frameSequence = 0;
+
+  //CLOCK_MONOTONIC nanoseconds of the readback
+  int64_t timestampNs = 0;
+
+  int32_t width = 0;
+  int32_t height = 0;
+
+  //in bytes
+  int32_t pitch = 0;
+};
+
+//frames are written to the slots in a round robin order
+inline SharedFrameSlotHeader *getSharedFrameSlot(uint8_t *ringMemory,
+    const SharedFrameRingHeader &header, const uint64_t frameSequence) {
+  const uint64_t slotIdx = frameSequence % header.slotsCount;
+  return reinterpret_cast<SharedFrameSlotHeader*>(ringMemory +
+      sizeof(SharedFrameRingHeader) + (slotIdx * header.slotStride));
+}
+
+#endif /* SDL_UTILS_SHAREDFRAMEDEFINES_H_ */
@@ -2,7 +2,6 @@
 #include "sdl_utils/containers/FboContainer.h"
 
 // System headers
-#include <cstring>
 
 // Other libraries headers
 #include "utils/LimitValues.h"
@@ -13,9 +12,6 @@
 #include "sdl_utils/drawing/Renderer.h"
 #include "sdl_utils/drawing/Texture.h"
 
-// basically anything different than nullptr
-#define RESERVE_SLOT_VALUE (reinterpret_cast<SDL_Texture *>(1))
-
 #define RGBA_BYTE_SIZE 4
 
 FboContainer::FboContainer()
@@ -23,62 +19,47 @@ FboContainer::FboContainer()
 }
 
 ErrorCode FboContainer::init(const int32_t maxRuntimeSpriteBuffers) {
+  if (ErrorCode::SUCCESS != _fboSlots.init(maxRuntimeSpriteBuffers)) {
+    LOGERR("Error in _fboSlots.init() for maxRuntimeSpriteBuffers: %d",
+           maxRuntimeSpriteBuffers);
+    return ErrorCode::FAILURE;
+  }
+
   _sbSize = maxRuntimeSpriteBuffers;
   _textures.resize(maxRuntimeSpriteBuffers, nullptr);
+  _fboIds.resize(maxRuntimeSpriteBuffers, INIT_INT32_VALUE);
   _fboMemoryUsage.resize(maxRuntimeSpriteBuffers, 0);
   return ErrorCode::SUCCESS;
 }
 
 void FboContainer::deinit() {
   for (int32_t i = 0; i < _sbSize; ++i) {
-    // free index found
-    if ((nullptr != _textures[i]) &&
-        (RESERVE_SLOT_VALUE != _textures[i])) {
+    if (nullptr != _textures[i]) {
       Texture::freeTexture(_textures[i]);
     }
   }
 
+  _fboSlots.logStats("FboContainer");
+  _fboSlots.deinit();
+
+  _fboIds.clear();
   _fboMemoryUsage.clear();
 }
 
 void FboContainer::createFbo(const int32_t width, const int32_t height,
                              int32_t &outContainerId) {
-  int32_t chosenIndex = INIT_INT32_VALUE;
-
-  for (int32_t i = 0; i < _sbSize; ++i) {
-    // free index found, occupy it
-    if (nullptr == _textures[i]) {
-      chosenIndex = i;
-      break;
-    }
-  }
-
-#ifndef NDEBUG
-  if (INIT_INT32_VALUE == chosenIndex) {
+  int32_t fboId = INIT_INT32_VALUE;
+  if (ErrorCode::SUCCESS != _fboSlots.allocate(fboId)) {
     LOGERR("Critical Problem: maxRunTimeSpriteBuffers value: %d is reached! "
            "Increase it's value from the configuration! or reduce the number of"
            " active SpriteBuffers. SpriteBuffer will not be created in order "
            "to save the system from crashing", _sbSize);
     return;
   }
-#endif //!NDEBUG
-
-  _textures[chosenIndex] = RESERVE_SLOT_VALUE;
-  outContainerId = chosenIndex;
-
-  uint8_t data[sizeof(width) + sizeof(height) + sizeof(chosenIndex)];
-  uint64_t populatedBytes = 0;
 
-  memcpy(data, &width, sizeof(width));
-  populatedBytes += sizeof(width);
+  outContainerId = fboId;
 
-  memcpy(data + populatedBytes, &height, sizeof(height));
-  populatedBytes += sizeof(height);
-
-  memcpy(data + populatedBytes, &outContainerId, sizeof(chosenIndex));
-  populatedBytes += sizeof(chosenIndex);
-
-  _renderer->addRendererCmd_UT(RendererCmd::CREATE_FBO, data, populatedBytes);
+  _renderer->addRendererCmd_UT(CreateFboPayload { width, height, fboId });
 }
 
 void FboContainer::destroyFbo(const int32_t uniqueContainerId) {
@@ -90,51 +71,57 @@ void FboContainer::destroyFbo(const int32_t uniqueContainerId) {
     return;
   }
 
-  if (uniqueContainerId >= _sbSize) {
-    LOGERR("Critical Error, uniqueContainerId: %d is outside of text container "
-           "size! There is an error in the internal business logic! Widget will"
-           " not be destroyed in order to save the system from crashing.",
-           uniqueContainerId);
+  // the slot is reused only by fbos, created after this one.
+  // Their CreateFbo commands are processed by the renderer thread
+  // after the DestroyFbo command below
+  if (ErrorCode::SUCCESS != _fboSlots.release(uniqueContainerId)) {
+    LOGERR("Critical Error, uniqueContainerId: %d is stale or outside of fbo "
+           "container size! There is an error in the internal business logic! "
+           "Widget will not be destroyed in order to save the system from "
+           "crashing.", uniqueContainerId);
     return;
   }
 
-  _renderer->addRendererCmd_UT(
-      RendererCmd::DESTROY_FBO,
-      reinterpret_cast<const uint8_t *>(&uniqueContainerId),
-      sizeof(uniqueContainerId));
+  _renderer->addRendererCmd_UT(DestroyFboPayload { uniqueContainerId });
 }
 void FboContainer::attachFbo(const int32_t containerId,
                              const int32_t createdWidth,
                              const int32_t createdHeight,
                              SDL_Texture *createdTexture)
 {
-  _textures[containerId] = createdTexture;
+  const int32_t idx = SlotAllocator::getIndex(containerId);
+  _textures[idx] = createdTexture;
+  _fboIds[idx] = containerId;
 
   // calculate how much GPU VRAM will be used
-  _fboMemoryUsage[containerId] =
+  _fboMemoryUsage[idx] =
       static_cast<uint64_t>((createdWidth * createdHeight * RGBA_BYTE_SIZE));
 
   // increase the occupied GPU memory usage counter for the new texture
-  _gpuMemoryUsage += _fboMemoryUsage[containerId];
+  _gpuMemoryUsage += _fboMemoryUsage[idx];
 }
 
 void FboContainer::getFboTexture(const int32_t uniqueId,
                                  SDL_Texture *&outTexture)
 {
-  // sanity check - check if such index exists
-  if (uniqueId < _sbSize) {
-    outTexture = _textures[uniqueId];
+  // sanity check - check if such index exists and is not reused
+  const int32_t idx = SlotAllocator::getIndex(uniqueId);
+  if ((0 <= uniqueId) && (idx < _sbSize) && (_fboIds[idx] == uniqueId)) {
+    outTexture = _textures[idx];
   } else {
-    LOGERR("Warning, trying to destroy sprite buffer with non-existent "
+    outTexture = nullptr;
+    LOGERR("Warning, trying to get sprite buffer with stale or non-existent "
            "uniqueContainerId: %d", uniqueId);
   }
 }
 
 void FboContainer::detachFbo(const int32_t containerId) {
-  _textures[containerId] = nullptr;
+  const int32_t idx = SlotAllocator::getIndex(containerId);
+  _textures[idx] = nullptr;
+  _fboIds[idx] = INIT_INT32_VALUE;
 
   // decrease the occupied GPU memory usage counter for the old texture
-  _gpuMemoryUsage -= _fboMemoryUsage[containerId];
+  _gpuMemoryUsage -= _fboMemoryUsage[idx];
 
-  _fboMemoryUsage[containerId] = 0;
+  _fboMemoryUsage[idx] = 0;
 }
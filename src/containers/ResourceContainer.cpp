@@ -2,6 +2,8 @@
 #include "sdl_utils/containers/ResourceContainer.h"
 
 // System headers
+#include <atomic>
+#include <limits>
 #include <thread>
 
 // Other libraries headers
@@ -18,25 +20,35 @@
 
 #define RGBA_BYTE_SIZE 4
 
+/** @brief generates the handle generation for a new container instance.
+ *         Generation 0 is skipped, so INVALID_RSRC_HANDLE is never issued
+ *  */
+static uint32_t generateRsrcHandleGeneration() {
+  constexpr uint32_t maxGeneration =
+      std::numeric_limits<RsrcHandle>::max() >> RSRC_HANDLE_INDEX_BITS;
+  static std::atomic<uint32_t> lastGeneration { 0 };
+
+  return (lastGeneration.fetch_add(1) % maxGeneration) + 1;
+}
+
 /** @brief used to load SDL_Surface's from file system async until a shutdown
  *         signal is provided
  *
- *  @param resQueue              - the resource Data queue (input)
- *  @param outSurfQueue          - the loaded surfaces queue (output)
- *  @param threadsLeftToComplete - number of threads still working on the async
- *                                 surface load from the file system
+ *  @param resQueue              - the resource load jobs queue (input)
+ *  @param outSurfQueue          - the loaded surfaces queue (output for
+ *                                 the jobs without a batch)
  *  @param resourceBinLocation   - absolute location for the resources bin
  *  */
 static void loadSurfacesFromFileSystemAsync(
-    ThreadSafeQueue<ResourceData> *resQueue,
+    ThreadSafeQueue<SurfaceLoadJob> *resQueue,
     ThreadSafeQueue<std::pair<uint64_t, SDL_Surface *>> *outSurfQueue,
     const std::string& resourceBinLocation) {
-  ResourceData resData;
+  SurfaceLoadJob job;
   std::string widgetPath;
   SDL_Surface *surface = nullptr;
 
   while (true) {
-    const auto [isShutdowned, hasTimedOut] = resQueue->waitAndPop(resData);
+    const auto [isShutdowned, hasTimedOut] = resQueue->waitAndPop(job);
     if (isShutdowned) {
       return;
     }
@@ -44,10 +56,19 @@ static void loadSurfacesFromFileSystemAsync(
       continue;
     }
 
+    const ResourceData &resData = job.rsrcData;
     widgetPath = resourceBinLocation;
     widgetPath.append(resData.header.path);
     if (ErrorCode::SUCCESS !=
         Texture::loadSurfaceFromFile(widgetPath.c_str(), surface)) {
+      // on demand request - report the failure only to its requester
+      if (nullptr != job.batch) {
+        LOGERR("Warning, error in loadSurfaceFromFile() for file %s",
+               resData.header.path.c_str());
+        job.batch->push(resData.header.hashValue, nullptr);
+        continue;
+      }
+
       LOGERR("Warning, error in loadSurfaceFromFile() for file %s. "
              "Terminating other resourceLoading",
              resData.header.path.c_str());
@@ -57,8 +78,13 @@ static void loadSurfacesFromFileSystemAsync(
       return;
     }
 
-    // push the newly generated SDL_Surface to the ThreadSafe Surface Queue
-    outSurfQueue->push(std::make_pair(resData.header.hashValue, surface));
+    if (nullptr != job.batch) {
+      // deliver the SDL_Surface directly to the request, which awaits it
+      job.batch->push(resData.header.hashValue, surface);
+    } else {
+      // push the newly generated SDL_Surface to the ThreadSafe Surface Queue
+      outSurfQueue->push(std::make_pair(resData.header.hashValue, surface));
+    }
 
     // reset the variable so it can be reused
     surface = nullptr;
@@ -67,6 +93,7 @@ static void loadSurfacesFromFileSystemAsync(
 
 ResourceContainer::ResourceContainer()
     : _renderer(nullptr),
+      _rsrcHandleGeneration(0),
       _resDataThreadQueue(nullptr),
       _loadedSurfacesThreadQueue(nullptr),
       _gpuMemoryUsage(0),
@@ -85,18 +112,19 @@ ErrorCode ResourceContainer::init(const std::string &resourcesFolderLocation,
   _rsrcDataMap.reserve(staticWidgetsCount + dynamicWidgetsCount);
 
   /** IMPORTANT NOTE:
-   *  _rsrcMap on the other hand contains only the static resources + dynamic
-   *  resources ONLY for the current loaded game.
-   *
-   *  Here a place for future expansion is left, where couple of games could
-   *  be opened simultaneously.
+   *  The texture slots are registered together with the resource data.
+   *  Reserve them, so the renderer thread never reads them while they
+   *  are being reallocated.
    * */
-  _rsrcMap.reserve(staticWidgetsCount + dynamicWidgetsCount);
+  _rsrcSlots.reserve(staticWidgetsCount + dynamicWidgetsCount);
+  _rsrcTextures.reserve(staticWidgetsCount + dynamicWidgetsCount);
+  _rsrcSlotOwners.reserve(staticWidgetsCount + dynamicWidgetsCount);
+  _rsrcHandleGeneration = generateRsrcHandleGeneration();
 
-  _resDataThreadQueue = new ThreadSafeQueue<ResourceData>;
+  _resDataThreadQueue = new ThreadSafeQueue<SurfaceLoadJob>;
 
   if (nullptr == _resDataThreadQueue) {
-    LOGERR("Error, bad alloc for ThreadSafeQueue<ResourceData>");
+    LOGERR("Error, bad alloc for ThreadSafeQueue<SurfaceLoadJob>");
     return ErrorCode::FAILURE;
   }
 
@@ -113,12 +141,16 @@ ErrorCode ResourceContainer::init(const std::string &resourcesFolderLocation,
 
 void ResourceContainer::deinit() {
   // free Image/Sprite Textures
-  for (auto& resourceWidgetPair : _rsrcMap) {
-    Texture::freeTexture(resourceWidgetPair.second);
+  for (SDL_Texture *&texture : _rsrcTextures) {
+    if (nullptr != texture) {
+      Texture::freeTexture(texture);
+    }
   }
 
-  // clear rsrcMap unordered_map and shrink size
-  _rsrcMap.clear();
+  // the issued handles are no longer valid
+  _rsrcSlots.clear();
+  _rsrcTextures.clear();
+  _rsrcSlotOwners.clear();
 
   // clear rsrcDataMap unordered_map and shrink size
   _rsrcDataMap.clear();
@@ -128,6 +160,7 @@ void ResourceContainer::deinit() {
     // send shutdown signals
     _resDataThreadQueue->shutdown();
     _loadedSurfacesThreadQueue->shutdown();
+    _surfaceLoadBatchPool.shutdown();
 
     using namespace std::literals;
 
@@ -154,16 +187,20 @@ void ResourceContainer::deinit() {
     thread.join();
   }
   _workerThreadPool.clear();
+
+  // no worker thread delivers into the batches anymore
+  _surfaceLoadBatchPool.deinit();
 }
 
 void ResourceContainer::storeRsrcData(ResourceData &resourceData) {
   _rsrcDataMap[resourceData.header.hashValue] = resourceData;
+  registerRsrcSlot(resourceData.header.hashValue);
 
   // initiate load only on 'static'(on_init) resource
   if (ResourceDefines::TextureLoadType::ON_INIT ==
       resourceData.textureLoadType) {
     // move the resource into the thread queue since it's no longer used
-    _resDataThreadQueue->push(std::move(resourceData));
+    _resDataThreadQueue->push(SurfaceLoadJob { std::move(resourceData) });
   }
 }
 
@@ -228,11 +265,8 @@ void ResourceContainer::loadAllStoredResources(
       hardwareThreadNumber);
 
   _isMultithreadTextureLoadingEnabled = true;
-  _renderer->addRendererCmd_UT(
-      RendererCmd::ENABLE_DISABLE_MULTITHREAD_TEXTURE_LOADING,
-      reinterpret_cast<const uint8_t *>(
-          &_isMultithreadTextureLoadingEnabled),
-      sizeof(_isMultithreadTextureLoadingEnabled));
+  _renderer->addRendererCmd_UT(EnableDisableMultithreadTextureLoadingPayload {
+      _isMultithreadTextureLoadingEnabled });
 
   loadAllStoredResourcesMultiCore(hardwareThreadNumber);
 }
@@ -277,14 +311,15 @@ void ResourceContainer::loadResourceOnDemandSingle(const uint64_t rsrcId) {
 
   resWidget.refCount = 1;
 
+  SurfaceLoadBatch *surfaceBatch = nullptr;
   if (_isMultithreadTextureLoadingEnabled) {
     // dispatch the resource data into the thread safe queue
-    _resDataThreadQueue->pushWithCopy(it->second);
+    surfaceBatch = _surfaceLoadBatchPool.acquire();
+    _resDataThreadQueue->push(SurfaceLoadJob { it->second, surfaceBatch });
   }
 
-  _renderer->addRendererCmd_UT(RendererCmd::LOAD_TEXTURE_SINGLE,
-                               reinterpret_cast<const uint8_t *>(&rsrcId),
-                               sizeof(rsrcId));
+  _renderer->addRendererCmd_UT(
+      LoadTextureSinglePayload { rsrcId, surfaceBatch });
 }
 
 void ResourceContainer::loadResourceOnDemandMultiple(
@@ -296,6 +331,12 @@ void ResourceContainer::loadResourceOnDemandMultiple(
   std::vector<uint64_t> rsrcIdsToSend;
   rsrcIdsToSend.reserve(RSRC_SIZE);
 
+  // all surfaces of the request are delivered into a single batch
+  SurfaceLoadBatch *surfaceBatch = nullptr;
+  if (_isMultithreadTextureLoadingEnabled) {
+    surfaceBatch = _surfaceLoadBatchPool.acquire();
+  }
+
   uint32_t itemsToPop = 0;
   for (uint32_t i = 0; i < RSRC_SIZE; ++i) {
     auto it = _rsrcDataMap.find(rsrcIds[i]);
@@ -317,7 +358,8 @@ void ResourceContainer::loadResourceOnDemandMultiple(
 
         if (_isMultithreadTextureLoadingEnabled) {
           // dispatch the resource data into the thread safe queue
-          _resDataThreadQueue->pushWithCopy(it->second);
+          _resDataThreadQueue->push(
+              SurfaceLoadJob { it->second, surfaceBatch });
         }
       } else  // initiate load on 'dynamic'(on_demand) resource
       {
@@ -340,20 +382,14 @@ void ResourceContainer::loadResourceOnDemandMultiple(
     }
   }
 
-  const uint64_t DATA_SIZE = sizeof(itemsToPop) + sizeof(batchId);
-  uint8_t data[DATA_SIZE];
-  uint64_t populatedBytes = 0;
-
-  memcpy(data, &itemsToPop, sizeof(itemsToPop));
-  populatedBytes += sizeof(itemsToPop);
-
-  memcpy(data + populatedBytes, &batchId, sizeof(batchId));
-  populatedBytes += sizeof(batchId);
-
-  _renderer->addRendererCmd_UT(RendererCmd::LOAD_TEXTURE_MULTIPLE, data,
-                               DATA_SIZE);
+  // nothing will be delivered into the batch
+  if ((nullptr != surfaceBatch) && (0 == itemsToPop)) {
+    _surfaceLoadBatchPool.release(surfaceBatch);
+    surfaceBatch = nullptr;
+  }
 
-  _renderer->addRendererData_UT(
+  _renderer->addRendererCmd_UT(
+      LoadTextureMultiplePayload { itemsToPop, batchId, surfaceBatch },
       reinterpret_cast<const uint8_t *>(rsrcIdsToSend.data()),
       (itemsToPop * sizeof(uint64_t)));
 }
@@ -377,9 +413,7 @@ void ResourceContainer::unloadResourceOnDemandSingle(const uint64_t rsrcId) {
 
   // when refCount goes to zero -> resource should be unloaded
   if (0 == resWidget.refCount) {
-    _renderer->addRendererCmd_UT(RendererCmd::DESTROY_TEXTURE,
-                                 reinterpret_cast<const uint8_t *>(&rsrcId),
-                                 sizeof(rsrcId));
+    _renderer->addRendererCmd_UT(DestroyTexturePayload { rsrcId });
   }
 }
 
@@ -412,9 +446,7 @@ void ResourceContainer::unloadResourceOnDemandMultiple(
 
     // when refCount goes to zero -> resource should be unloaded
     if (0 == resWidget.refCount) {
-      _renderer->addRendererCmd_UT(
-          RendererCmd::DESTROY_TEXTURE,
-          reinterpret_cast<const uint8_t *>(&rsrcIds[i]), sizeof(rsrcIds[i]));
+      _renderer->addRendererCmd_UT(DestroyTexturePayload { rsrcIds[i] });
     }
   }
 }
@@ -424,8 +456,12 @@ void ResourceContainer::attachRsrcTexture(const uint64_t rsrcId,
                                           const int32_t createdHeight,
                                           SDL_Texture *createdTexture)
 {
-  // directly populate the rsrcMap with the newly created SDL_Texture
-  _rsrcMap[rsrcId] = createdTexture;
+  // directly populate the texture slot with the newly created SDL_Texture
+  if (!setRsrcSlotTexture(rsrcId, createdTexture)) {
+    LOGERR("Error, trying to attach rsrcId: %" PRIu64" which is not "
+           "registered", rsrcId);
+    return;
+  }
 
   // increase the occupied GPU memory usage counter for the new texture
   _gpuMemoryUsage +=
@@ -435,26 +471,94 @@ void ResourceContainer::attachRsrcTexture(const uint64_t rsrcId,
 void ResourceContainer::getRsrcTexture(const uint64_t rsrcId,
                                        SDL_Texture *&outTexture)
 {
-  auto it = _rsrcMap.find(rsrcId);
+  auto it = _rsrcSlots.find(rsrcId);
 
-  // key found
-  if (it != _rsrcMap.end()) {
-    outTexture = it->second;
+  // key found and the texture is loaded
+  if ((it != _rsrcSlots.end()) && (nullptr != _rsrcTextures[it->second])) {
+    outTexture = _rsrcTextures[it->second];
   } else  // key not found
   {
     LOGERR("Error, rsrcTexture for rsrcId: %" PRIu64" not found", rsrcId);
   }
 }
 
+RsrcHandle ResourceContainer::getRsrcHandle(const uint64_t rsrcId) const {
+  auto it = _rsrcSlots.find(rsrcId);
+  if (it == _rsrcSlots.end()) {
+    LOGERR("Error, rsrcId: %" PRIu64" is not registered", rsrcId);
+    return INVALID_RSRC_HANDLE;
+  }
+
+  return (_rsrcHandleGeneration << RSRC_HANDLE_INDEX_BITS) | it->second;
+}
+
+void ResourceContainer::registerRsrcSlot(const uint64_t rsrcId) {
+  if (_rsrcSlots.end() != _rsrcSlots.find(rsrcId)) {
+    return;
+  }
+
+  const uint32_t slotIdx = static_cast<uint32_t>(_rsrcTextures.size());
+  if (slotIdx > RSRC_HANDLE_INDEX_MASK) {
+    LOGERR("Critical Problem: max resources count: %u is reached! rsrcId: "
+           "%" PRIu64" will not be registered", RSRC_HANDLE_INDEX_MASK + 1,
+           rsrcId);
+    return;
+  }
+
+  if (_rsrcTextures.size() == _rsrcTextures.capacity()) {
+    LOGERR("Warning, registering more resources than the static + dynamic "
+           "widgets count, provided on init(). The texture slots will be "
+           "reallocated, which is not safe while rendering");
+  }
+
+  _rsrcSlots.emplace(rsrcId, slotIdx);
+  _rsrcTextures.push_back(nullptr);
+  _rsrcSlotOwners.push_back(rsrcId);
+}
+
+bool ResourceContainer::setRsrcSlotTexture(const uint64_t rsrcId,
+                                           SDL_Texture *texture) {
+  auto it = _rsrcSlots.find(rsrcId);
+  if (it == _rsrcSlots.end()) {
+    return false;
+  }
+
+  _rsrcTextures[it->second] = texture;
+  return true;
+}
+
+bool ResourceContainer::isValidRsrcHandle(const RsrcHandle rsrcHandle,
+                                          const uint64_t rsrcId) const {
+  const uint32_t slotIdx = rsrcHandle & RSRC_HANDLE_INDEX_MASK;
+  const uint32_t generation = rsrcHandle >> RSRC_HANDLE_INDEX_BITS;
+  if (generation != _rsrcHandleGeneration) {
+    LOGERR("Error, stale rsrcHandle: %u for rsrcId: %" PRIu64". Handle "
+           "generation: %u, container generation: %u", rsrcHandle, rsrcId,
+           generation, _rsrcHandleGeneration);
+    return false;
+  }
+
+  if ((slotIdx >= _rsrcSlotOwners.size()) ||
+      (rsrcId != _rsrcSlotOwners[slotIdx])) {
+    LOGERR("Error, rsrcHandle: %u does not belong to rsrcId: %" PRIu64"",
+           rsrcHandle, rsrcId);
+    return false;
+  }
+
+  return true;
+}
+
 void ResourceContainer::detachRsrcTexture(const uint64_t rsrcId) {
-  auto rsrcMapIt = _rsrcMap.find(rsrcId);
-  if (rsrcMapIt == _rsrcMap.end()) {
+  auto rsrcSlotIt = _rsrcSlots.find(rsrcId);
+  if ((rsrcSlotIt == _rsrcSlots.end()) ||
+      (nullptr == _rsrcTextures[rsrcSlotIt->second])) {
     LOGERR("Error, trying to detach rsrcId: %" PRIu64" which is not existing",
         rsrcId);
     return;
   }
 
-  _rsrcMap.erase(rsrcMapIt);
+  // the slot stays registered, so the issued handles stay valid
+  _rsrcTextures[rsrcSlotIt->second] = nullptr;
 
   auto rsrcDataMapIt = _rsrcDataMap.find(rsrcId);
   if (rsrcDataMapIt == _rsrcDataMap.end()) {
@@ -504,11 +608,12 @@ void ResourceContainer::loadAllStoredResourcesSingleCore() {
   // NOTE: some of the thread safe mechanism such as ThreadSafeQueue as reused.
   // the overhead is minimal and the source will be reused.
 
-  ResourceData resData;
+  SurfaceLoadJob job;
   std::string widgetPath;
   SDL_Surface *newSurface = nullptr;
 
-  while (_resDataThreadQueue->tryPop(resData)) {
+  while (_resDataThreadQueue->tryPop(job)) {
+    const ResourceData &resData = job.rsrcData;
     widgetPath = _resourcesFolderLocation;
     widgetPath.append(resData.header.path);
     if (ErrorCode::SUCCESS !=
@@ -562,8 +667,8 @@ void ResourceContainer::loadAllStoredResourcesSingleCore() {
     _gpuMemoryUsage += static_cast<uint64_t>(currSurfaceWidth)
         * currSurfaceHeight * RGBA_BYTE_SIZE;
 
-    // store the generates SDL_Texture into the rsrcMap
-    _rsrcMap[currResSurface.first] = newTexture;
+    // store the generates SDL_Texture into the texture slot
+    setRsrcSlotTexture(currResSurface.first, newTexture);
 
     // NOTE: if HARDWARE_RENDERER is used -> divide the load time between:
     //          > creating the SDL_Surface;
@@ -636,8 +741,8 @@ void ResourceContainer::loadAllStoredResourcesMultiCore(
       _gpuMemoryUsage += static_cast<uint64_t>(currSurfaceWidth)
           * currSurfaceHeight * RGBA_BYTE_SIZE;
 
-      // emplace GPU Texture to the rsrcMap
-      _rsrcMap[currResSurface.first] = newTexture;
+      // store the GPU Texture into the texture slot
+      setRsrcSlotTexture(currResSurface.first, newTexture);
 
       // send message to loading screen for
       // successfully loaded resource
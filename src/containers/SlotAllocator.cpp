@@ -0,0 +1,95 @@
+// Corresponding header
+#include "sdl_utils/containers/SlotAllocator.h"
+
+// System headers
+#include <algorithm>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+ErrorCode SlotAllocator::init(const int32_t capacity) {
+  if ((0 > capacity) || (MAX_CAPACITY < capacity)) {
+    LOGERR("Error, invalid SlotAllocator capacity: %d. Supported range is "
+           "[0 - %d]", capacity, MAX_CAPACITY);
+    return ErrorCode::FAILURE;
+  }
+
+  _capacity = capacity;
+  _occupiedCount = 0;
+  _peakOccupiedCount = 0;
+  _generations.assign(capacity, 0);
+  _occupied.assign(capacity, 0);
+
+  // push in reverse, so the lowest indexes are handed out first
+  _freeSlots.resize(capacity);
+  for (int32_t i = 0; i < capacity; ++i) {
+    _freeSlots[i] = capacity - 1 - i;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void SlotAllocator::deinit() {
+  _freeSlots.clear();
+  _generations.clear();
+  _occupied.clear();
+  _capacity = 0;
+  _occupiedCount = 0;
+}
+
+ErrorCode SlotAllocator::allocate(int32_t &outId) {
+  if (_freeSlots.empty()) {
+    return ErrorCode::FAILURE;
+  }
+
+  const int32_t idx = _freeSlots.back();
+  _freeSlots.pop_back();
+
+  _occupied[idx] = 1;
+  ++_occupiedCount;
+  _peakOccupiedCount = std::max(_peakOccupiedCount, _occupiedCount);
+
+  outId = (_generations[idx] << INDEX_BITS) | idx;
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode SlotAllocator::release(const int32_t id) {
+  if (!isAlive(id)) {
+    return ErrorCode::FAILURE;
+  }
+
+  const int32_t idx = getIndex(id);
+  _occupied[idx] = 0;
+  --_occupiedCount;
+  _generations[idx] = (_generations[idx] + 1) & GENERATION_MASK;
+  _freeSlots.push_back(idx);
+
+  return ErrorCode::SUCCESS;
+}
+
+SlotAllocatorStats SlotAllocator::getStats() const {
+  SlotAllocatorStats stats;
+  stats.capacity = _capacity;
+  stats.occupied = _occupiedCount;
+  stats.peakOccupied = _peakOccupiedCount;
+
+  for (int32_t i = _capacity - 1; i >= 0; --i) {
+    if (_occupied[i]) {
+      stats.usedSpan = i + 1;
+      break;
+    }
+  }
+  stats.compactableSlots = stats.usedSpan - stats.occupied;
+
+  return stats;
+}
+
+void SlotAllocator::logStats(const char *ownerName) const {
+  const SlotAllocatorStats stats = getStats();
+  LOG("%s slots - capacity: %d, occupied: %d, peak occupied: %d, "
+      "used span: %d, compactable: %d", ownerName, stats.capacity,
+      stats.occupied, stats.peakOccupied, stats.usedSpan,
+      stats.compactableSlots);
+}
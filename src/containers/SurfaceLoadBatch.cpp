@@ -0,0 +1,86 @@
+// Corresponding header
+#include "sdl_utils/containers/SurfaceLoadBatch.h"
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+void SurfaceLoadBatch::push(const uint64_t rsrcId, SDL_Surface *surface) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _completed.emplace_back(rsrcId, surface);
+  }
+
+  _completedCondVar.notify_one();
+}
+
+bool SurfaceLoadBatch::waitAndPop(
+    std::pair<uint64_t, SDL_Surface *> &outRsrcSurface) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _completedCondVar.wait(lock, [this]() {
+    return _isShutdowned || (_completed.size() > _consumedCount);
+  });
+
+  if (_isShutdowned) {
+    return false;
+  }
+
+  outRsrcSurface = _completed[_consumedCount];
+  ++_consumedCount;
+  return true;
+}
+
+void SurfaceLoadBatch::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isShutdowned = true;
+  }
+
+  _completedCondVar.notify_all();
+}
+
+void SurfaceLoadBatch::reset() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // keep the capacity for the next request
+  _completed.clear();
+  _consumedCount = 0;
+  _isShutdowned = false;
+}
+
+SurfaceLoadBatch *SurfaceLoadBatchPool::acquire() {
+  SurfaceLoadBatch *batch = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_freeBatches.empty()) {
+      _batches.push_back(std::make_unique<SurfaceLoadBatch>());
+      return _batches.back().get();
+    }
+
+    batch = _freeBatches.back();
+    _freeBatches.pop_back();
+  }
+
+  batch->reset();
+  return batch;
+}
+
+void SurfaceLoadBatchPool::release(SurfaceLoadBatch *batch) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _freeBatches.push_back(batch);
+}
+
+void SurfaceLoadBatchPool::shutdown() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto &batch : _batches) {
+    batch->shutdown();
+  }
+}
+
+void SurfaceLoadBatchPool::deinit() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _freeBatches.clear();
+  _batches.clear();
+}
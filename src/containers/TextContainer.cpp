@@ -14,9 +14,6 @@
 #include "sdl_utils/drawing/Renderer.h"
 #include "sdl_utils/drawing/Texture.h"
 
-// basically anything different than nullptr
-#define RESERVE_SLOT_VALUE (reinterpret_cast<SDL_Texture *>(1))
-
 #define RGBA_BYTE_SIZE 4
 
 TextContainer::TextContainer()
@@ -27,9 +24,16 @@ TextContainer::TextContainer()
 ErrorCode TextContainer::init(
     std::unordered_map<uint64_t, TTF_Font *> *fontsContainer,
     const int32_t maxRuntimeTexts) {
+  if (ErrorCode::SUCCESS != _textSlots.init(maxRuntimeTexts)) {
+    LOGERR("Error in _textSlots.init() for maxRuntimeTexts: %d",
+           maxRuntimeTexts);
+    return ErrorCode::FAILURE;
+  }
+
   _textsSize = maxRuntimeTexts;
   _fontsMapPtr = fontsContainer;
   _texts.resize(maxRuntimeTexts, nullptr);
+  _textIds.resize(maxRuntimeTexts, INIT_INT32_VALUE);
   _textMemoryUsage.resize(maxRuntimeTexts, 0);
 
   return ErrorCode::SUCCESS;
@@ -40,12 +44,15 @@ void TextContainer::deinit() {
   _fontsMapPtr = nullptr;
 
   for (int32_t i = 0; i < _textsSize; ++i) {
-    // free index found
-    if ((nullptr != _texts[i]) && ((RESERVE_SLOT_VALUE != _texts[i]))) {
+    if (nullptr != _texts[i]) {
       Texture::freeTexture(_texts[i]);
     }
   }
 
+  _textSlots.logStats("TextContainer");
+  _textSlots.deinit();
+
+  _textIds.clear();
   _textMemoryUsage.clear();
 }
 
@@ -68,59 +75,22 @@ ErrorCode TextContainer::loadText(const uint64_t fontId, const char *text,
     return ErrorCode::FAILURE;
   }
 
-  int32_t chosenIndex = INIT_INT32_VALUE;
-
-  for (int32_t i = 0; i < _textsSize; ++i) {
-    // free index found, occupy it
-    if (nullptr == _texts[i]) {
-      chosenIndex = i;
-      break;
-    }
-  }
-
-#ifndef NDEBUG
-  if (INIT_INT32_VALUE == chosenIndex) {
+  int32_t textId = INIT_INT32_VALUE;
+  if (ErrorCode::SUCCESS != _textSlots.allocate(textId)) {
     LOGERR("Critical Problem: maxRunTimeTexts value: %d is reached! "
            "Increase it's value from the configuration! or reduce the number of"
            " active texts. Text with content: %s will not be created in order "
            "to save the system from crashing", _textsSize, text);
     return ErrorCode::FAILURE;
   }
-#endif //!NDEBUG
 
-  _texts[chosenIndex] = RESERVE_SLOT_VALUE;
-  outUniqueId = chosenIndex;
+  outUniqueId = textId;
 
   const uint64_t textLen = strlen(text);
-  const uint64_t dataSize = sizeof(chosenIndex) + sizeof(fontId) + sizeof(color) +
-               sizeof(textLen) + textLen;
-  uint8_t* data = new uint8_t[dataSize];
-  if (nullptr == data) {
-    LOGERR("Error, bad alloc for 'data'");
-    return ErrorCode::FAILURE;
-  }
-
-  uint64_t populatedBytes = 0;
-
-  memcpy(data, &chosenIndex, sizeof(chosenIndex));
-  populatedBytes += sizeof(chosenIndex);
-
-  memcpy(data + populatedBytes, &fontId, sizeof(fontId));
-  populatedBytes += sizeof(fontId);
-
-  memcpy(data + populatedBytes, &color, sizeof(color));
-  populatedBytes += sizeof(color);
+  _renderer->addRendererCmd_UT(
+      CreateTTFTextPayload { textId, fontId, color, textLen },
+      reinterpret_cast<const uint8_t *>(text), textLen);
 
-  memcpy(data + populatedBytes, &textLen, sizeof(textLen));
-  populatedBytes += sizeof(textLen);
-
-  memcpy(data + populatedBytes, text, textLen);
-  populatedBytes += textLen;
-
-  _renderer->addRendererCmd_UT(RendererCmd::CREATE_TTF_TEXT, data,
-                               populatedBytes);
-
-  delete[] data;
   return ErrorCode::SUCCESS;
 }
  
@@ -128,6 +98,12 @@ void TextContainer::reloadText(const uint64_t fontId, const char *text,
                                const Color &color,
                                const int32_t textUniqueId,
                                int32_t &outTextWidth, int32_t &outTextHeight) {
+  if (!_textSlots.isAlive(textUniqueId)) {
+    LOGERR("Warning, trying to reload text with stale or non-existent "
+           "uniqueId: %d", textUniqueId);
+    return;
+  }
+
   if (ErrorCode::SUCCESS !=
       Texture::getTextDimensions(text, (*_fontsMapPtr)[fontId],
                                  outTextWidth, outTextHeight)) {
@@ -136,33 +112,9 @@ void TextContainer::reloadText(const uint64_t fontId, const char *text,
   }
 
   const uint64_t textLen = strlen(text);
-  const uint64_t dataSize = sizeof(textUniqueId) + sizeof(fontId) + sizeof(color) +
-               sizeof(textLen) + textLen;
-  uint8_t* data = new uint8_t[dataSize];
-  if (nullptr == data) {
-    LOGERR("Error, bad alloc for 'data'");
-  }
-
-  uint64_t populatedBytes = 0;
-
-  memcpy(data, &textUniqueId, sizeof(textUniqueId));
-  populatedBytes += sizeof(textUniqueId);
-
-  memcpy(data + populatedBytes, &fontId, sizeof(fontId));
-  populatedBytes += sizeof(fontId);
-
-  memcpy(data + populatedBytes, &color, sizeof(color));
-  populatedBytes += sizeof(color);
-
-  memcpy(data + populatedBytes, &textLen, sizeof(textLen));
-  populatedBytes += sizeof(textLen);
-
-  memcpy(data + populatedBytes, text, textLen);
-  populatedBytes += textLen;
-
-  _renderer->addRendererCmd_UT(RendererCmd::RELOAD_TTF_TEXT, data,
-                               populatedBytes);
-  delete[] data;
+  _renderer->addRendererCmd_UT(
+      ReloadTTFTextPayload { { textUniqueId, fontId, color, textLen } },
+      reinterpret_cast<const uint8_t *>(text), textLen);
 }
 
 void TextContainer::unloadText(const int32_t textUniqueId) {
@@ -174,17 +126,18 @@ void TextContainer::unloadText(const int32_t textUniqueId) {
     return;
   }
 
-  if (textUniqueId >= _textsSize) {
-    LOGERR("Critical Error, textUniqueId: %d is outside of text container size!"
-           " There is an error in the internal business logic! Widget will not "
-           "be destroyed in order to save the system from crashing.",
-           textUniqueId);
+  // the slot is reused only by texts, created after this one.
+  // Their CreateTTFText commands are processed by the renderer thread
+  // after the DestroyTTFText command below
+  if (ErrorCode::SUCCESS != _textSlots.release(textUniqueId)) {
+    LOGERR("Critical Error, textUniqueId: %d is stale or outside of text "
+           "container size! There is an error in the internal business logic! "
+           "Widget will not be destroyed in order to save the system from "
+           "crashing.", textUniqueId);
     return;
   }
 
-  _renderer->addRendererCmd_UT(RendererCmd::DESTROY_TTF_TEXT,
-                               reinterpret_cast<const uint8_t *>(&textUniqueId),
-                               sizeof(textUniqueId));
+  _renderer->addRendererCmd_UT(DestroyTTFTextPayload { textUniqueId });
 }
 
 void TextContainer::attachText(const int32_t containerId,
@@ -192,34 +145,40 @@ void TextContainer::attachText(const int32_t containerId,
                                const int32_t createdHeight,
                                SDL_Texture *createdTexture)
 {
-  _texts[containerId] = createdTexture;
+  const int32_t idx = SlotAllocator::getIndex(containerId);
+  _texts[idx] = createdTexture;
+  _textIds[idx] = containerId;
 
   // calculate how much GPU VRAM will be used
-  _textMemoryUsage[containerId] =
+  _textMemoryUsage[idx] =
       static_cast<uint64_t>(createdWidth) * createdHeight * RGBA_BYTE_SIZE;
 
   // increase the occupied GPU memory usage counter for the new texture
-  _gpuMemoryUsage += _textMemoryUsage[containerId];
+  _gpuMemoryUsage += _textMemoryUsage[idx];
 }
 
 void TextContainer::getTextTexture(const int32_t uniqueId,
                                    SDL_Texture *&outTexture)
 {
-  // sanity check - check if such index exists
-  if (uniqueId < _textsSize) {
-    outTexture = _texts[uniqueId];
+  // sanity check - check if such index exists and is not reused
+  const int32_t idx = SlotAllocator::getIndex(uniqueId);
+  if ((0 <= uniqueId) && (idx < _textsSize) && (_textIds[idx] == uniqueId)) {
+    outTexture = _texts[idx];
   } else {
-    LOGERR("Warning, trying to get text with non-existent uniqueId: %d",
-           uniqueId);
+    outTexture = nullptr;
+    LOGERR("Warning, trying to get text with stale or non-existent "
+           "uniqueId: %d", uniqueId);
   }
 }
 
 void TextContainer::detachText(const int32_t containerId) {
-  _texts[containerId] = nullptr;
+  const int32_t idx = SlotAllocator::getIndex(containerId);
+  _texts[idx] = nullptr;
+  _textIds[idx] = INIT_INT32_VALUE;
 
   // decrease the occupied GPU memory usage counter for the old texture
-  _gpuMemoryUsage -= _textMemoryUsage[containerId];
+  _gpuMemoryUsage -= _textMemoryUsage[idx];
 
-  _textMemoryUsage[containerId] = 0;
+  _textMemoryUsage[idx] = 0;
 }
 
@@ -0,0 +1,230 @@
+// Corresponding header
+#include "sdl_utils/drawing/DrawBatcher.h"
+
+// System headers
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+// Other libraries headers
+#include <SDL_render.h>
+#include <SDL_version.h>
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/FrameWidgets.h"
+
+namespace {
+constexpr uint32_t VERTICES_PER_QUAD = 4;
+constexpr uint32_t INDICES_PER_QUAD = 6;
+
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+}
+
+ErrorCode DrawBatcher::init(SDL_Renderer *renderer,
+                            const uint32_t maxBatchWidgets) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  static_assert(sizeof(Vertex) == sizeof(SDL_Vertex),
+      "DrawBatcher::Vertex must be layout compatible with SDL_Vertex");
+  static_assert(offsetof(Vertex, r) == offsetof(SDL_Vertex, color),
+      "DrawBatcher::Vertex must be layout compatible with SDL_Vertex");
+  static_assert(offsetof(Vertex, u) == offsetof(SDL_Vertex, tex_coord),
+      "DrawBatcher::Vertex must be layout compatible with SDL_Vertex");
+#else
+  LOGERR("Error, SDL_RenderGeometry() requires SDL 2.0.18 or newer");
+  return ErrorCode::FAILURE;
+#endif /* SDL_VERSION_ATLEAST(2, 0, 18) */
+
+  if (nullptr == renderer) {
+    LOGERR("Error, nullptr renderer provided");
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 == maxBatchWidgets) {
+    LOGERR("Error, maxBatchWidgets can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  _renderer = renderer;
+  _maxBatchWidgets = maxBatchWidgets;
+  _vertices.reserve(_maxBatchWidgets * VERTICES_PER_QUAD);
+
+  _indices.resize(_maxBatchWidgets * INDICES_PER_QUAD);
+  for (uint32_t i = 0; i < _maxBatchWidgets; ++i) {
+    const int32_t vertexIdx = static_cast<int32_t>(i * VERTICES_PER_QUAD);
+    int32_t *quadIndices = &_indices[i * INDICES_PER_QUAD];
+
+    // two triangles: top-left, top-right, bottom-right, bottom-left
+    quadIndices[0] = vertexIdx;
+    quadIndices[1] = vertexIdx + 1;
+    quadIndices[2] = vertexIdx + 2;
+    quadIndices[3] = vertexIdx + 2;
+    quadIndices[4] = vertexIdx + 3;
+    quadIndices[5] = vertexIdx;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+bool DrawBatcher::addWidget(const FrameWidgets &widgets, const uint32_t idx) {
+  SDL_Texture *texture = widgets.texture[idx];
+  if (nullptr == texture) {
+    return false;
+  }
+
+  // the destination quad is already resolved on submission
+  const int32_t quadX = widgets.x[idx];
+  const int32_t quadY = widgets.y[idx];
+  const int32_t quadW = widgets.width[idx];
+  const int32_t quadH = widgets.height[idx];
+
+  // visible part of the destination quad (the renderer clip rectangle)
+  const int32_t visibleW = widgets.visibleWidth[idx];
+  const int32_t visibleH = widgets.visibleHeight[idx];
+
+  if ((0 == quadW) || (0 == quadH)) {
+    return true; // nothing to draw
+  }
+
+  const uint8_t flags = widgets.flags[idx];
+  const bool isRotated = (FrameWidgets::IS_ROTATED & flags);
+  if (isRotated && (FrameWidgets::IS_CLIPPED & flags)) {
+    return false;
+  }
+
+  if (_vertices.size() == (_maxBatchWidgets * VERTICES_PER_QUAD)) {
+    flush();
+  }
+
+  if (texture != _batchTexture) {
+    flush();
+    if (!beginBatch(texture)) {
+      return false;
+    }
+  }
+
+  // texture coordinates of the source rectangle
+  const Rectangle &srcRect = widgets.srcRect[idx];
+  const float srcU0 = srcRect.x * _invTextureWidth;
+  const float srcV0 = srcRect.y * _invTextureHeight;
+  const float srcU1 = (srcRect.x + srcRect.w) * _invTextureWidth;
+  const float srcV1 = (srcRect.y + srcRect.h) * _invTextureHeight;
+
+  // the clipped part of the quad is cut from the texture coordinates
+  const float visibleFractionX = static_cast<float>(visibleW) / quadW;
+  const float visibleFractionY = static_cast<float>(visibleH) / quadH;
+
+  const auto sdlFlip = static_cast<SDL_RendererFlip>(widgets.flipType[idx]);
+  float u0 = srcU0;
+  float u1 = srcU0 + (visibleFractionX * (srcU1 - srcU0));
+  if (SDL_FLIP_HORIZONTAL & sdlFlip) {
+    u0 = srcU1;
+    u1 = srcU1 - (visibleFractionX * (srcU1 - srcU0));
+  }
+
+  float v0 = srcV0;
+  float v1 = srcV0 + (visibleFractionY * (srcV1 - srcV0));
+  if (SDL_FLIP_VERTICAL & sdlFlip) {
+    v0 = srcV1;
+    v1 = srcV1 - (visibleFractionY * (srcV1 - srcV0));
+  }
+
+  /** WidgetType::IMAGE opacity is applied only for the draw call.
+   *  WidgetType::TEXT and WidgetType::SPRITE_BUFFER opacity lives in the
+   *  texture alpha modulation (see Renderer::changeTextureOpacity_RT()).
+   * */
+  const uint8_t alpha = (WidgetType::IMAGE == widgets.widgetType[idx])
+      ? static_cast<uint8_t>(widgets.opacity[idx]) : _textureAlphaMod;
+
+  const float x0 = static_cast<float>(quadX);
+  const float y0 = static_cast<float>(quadY);
+  const float x1 = static_cast<float>(quadX + visibleW);
+  const float y1 = static_cast<float>(quadY + visibleH);
+
+  Vertex quad[VERTICES_PER_QUAD];
+  quad[0].x = x0; quad[0].y = y0; quad[0].u = u0; quad[0].v = v0;
+  quad[1].x = x1; quad[1].y = y0; quad[1].u = u1; quad[1].v = v0;
+  quad[2].x = x1; quad[2].y = y1; quad[2].u = u1; quad[2].v = v1;
+  quad[3].x = x0; quad[3].y = y1; quad[3].u = u0; quad[3].v = v1;
+
+  if (isRotated) {
+    // same as SDL_RenderCopyEx() - clockwise around the rotation center
+    const double radians = widgets.angle[idx] * DEG_TO_RAD;
+    const float cosA = static_cast<float>(std::cos(radians));
+    const float sinA = static_cast<float>(std::sin(radians));
+    const Point &rotCenter = widgets.rotCenter[idx];
+    const float centerX = x0 + rotCenter.x;
+    const float centerY = y0 + rotCenter.y;
+
+    for (Vertex &vertex : quad) {
+      const float relX = vertex.x - centerX;
+      const float relY = vertex.y - centerY;
+      vertex.x = centerX + (relX * cosA) - (relY * sinA);
+      vertex.y = centerY + (relX * sinA) + (relY * cosA);
+    }
+  }
+
+  for (Vertex &vertex : quad) {
+    vertex.r = FULL_OPACITY;
+    vertex.g = FULL_OPACITY;
+    vertex.b = FULL_OPACITY;
+    vertex.a = alpha;
+    _vertices.push_back(vertex);
+  }
+
+  return true;
+}
+
+void DrawBatcher::flush() {
+  /** Texture properties are re-evaluated for every batch, because they could
+   *  be changed by the renderer commands between the batches
+   * */
+  SDL_Texture *texture = _batchTexture;
+  _batchTexture = nullptr;
+
+  if (_vertices.empty()) {
+    return;
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  const int32_t verticesCount = static_cast<int32_t>(_vertices.size());
+  const int32_t indicesCount =
+      (verticesCount / VERTICES_PER_QUAD) * INDICES_PER_QUAD;
+
+  if (EXIT_SUCCESS != SDL_RenderGeometry(_renderer, texture,
+          reinterpret_cast<const SDL_Vertex*>(_vertices.data()), verticesCount,
+          _indices.data(), indicesCount)) {
+    LOGERR("Error in SDL_RenderGeometry(), SDL Error: %s", SDL_GetError());
+  }
+#endif /* SDL_VERSION_ATLEAST(2, 0, 18) */
+
+  _vertices.clear();
+}
+
+bool DrawBatcher::beginBatch(SDL_Texture *texture) {
+  int32_t textureWidth = 0;
+  int32_t textureHeight = 0;
+  if (EXIT_SUCCESS != SDL_QueryTexture(texture, nullptr, nullptr,
+          &textureWidth, &textureHeight)) {
+    LOGERR("Error in SDL_QueryTexture(), SDL Error: %s", SDL_GetError());
+    _batchTexture = nullptr;
+    return false;
+  }
+
+  if (EXIT_SUCCESS != SDL_GetTextureAlphaMod(texture, &_textureAlphaMod)) {
+    LOGERR("Error in SDL_GetTextureAlphaMod(), SDL Error: %s", SDL_GetError());
+    _batchTexture = nullptr;
+    return false;
+  }
+
+  if ((0 == textureWidth) || (0 == textureHeight)) {
+    _batchTexture = nullptr;
+    return false;
+  }
+
+  _batchTexture = texture;
+  _invTextureWidth = 1.f / textureWidth;
+  _invTextureHeight = 1.f / textureHeight;
+
+  return true;
+}
@@ -9,10 +9,12 @@
 
 DrawParams::DrawParams() :
   rsrcId(0),
+  rsrcHandle(INVALID_RSRC_HANDLE),
   scaledWidth(0),
   scaledHeight(0),
   angle(0.0),
   opacity(FULL_OPACITY),
+  layer(0),
   widgetType(WidgetType::UNKNOWN),
   widgetFlipType(WidgetFlipType::NONE),
   hasCrop(false),
@@ -22,12 +24,14 @@ DrawParams::DrawParams() :
 
 void DrawParams::reset() {
     rsrcId = 0;
+    rsrcHandle = INVALID_RSRC_HANDLE;
     pos = Points::ZERO;
     rotCenter = Points::ZERO;
     scaledWidth = 0;
     scaledHeight = 0;
     angle = 0.0;
     opacity = FULL_OPACITY;
+    layer = 0;
     hasCrop = false;
     hasScaling = false;
 }
@@ -0,0 +1,296 @@
+// Corresponding header
+#include "sdl_utils/drawing/DrawParamsCodec.h"
+
+// System headers
+#include <cstring>
+#include <limits>
+
+// Other libraries headers
+
+// Own components headers
+#include "sdl_utils/drawing/DrawParams.h"
+
+namespace {
+enum HeaderBits : uint16_t {
+  WIDGET_TYPE_MASK = 0x0003,
+  FLIP_TYPE_SHIFT = 2,
+  FLIP_TYPE_MASK = 0x000C,
+  HAS_CROP = 0x0010,
+  HAS_SCALING = 0x0020,
+  HAS_ANGLE = 0x0040,
+  HAS_DOUBLE_ANGLE = 0x0080,
+  HAS_OPACITY = 0x0100,
+  HAS_WIDE_COORDS = 0x0200,
+  HAS_LAYER = 0x0400
+};
+
+// WidgetType::UNKNOWN does not fit in the 2 header bits
+constexpr uint16_t PACKED_UNKNOWN_WIDGET_TYPE = 3;
+
+uint16_t packWidgetType(const WidgetType type) {
+  return (WidgetType::UNKNOWN == type) ? PACKED_UNKNOWN_WIDGET_TYPE
+                                       : static_cast<uint16_t>(type);
+}
+
+WidgetType unpackWidgetType(const uint16_t header) {
+  const uint16_t packedType = header & WIDGET_TYPE_MASK;
+  return (PACKED_UNKNOWN_WIDGET_TYPE == packedType)
+      ? WidgetType::UNKNOWN : static_cast<WidgetType>(packedType);
+}
+
+bool fitsInt16(const int32_t value) {
+  return (std::numeric_limits<int16_t>::min() <= value) &&
+         (std::numeric_limits<int16_t>::max() >= value);
+}
+
+bool fitsInt16(const Rectangle &rect) {
+  return fitsInt16(rect.x) && fitsInt16(rect.y) &&
+         fitsInt16(rect.w) && fitsInt16(rect.h);
+}
+
+class PackedWriter {
+public:
+  explicit PackedWriter(uint8_t *data) : _data(data) {}
+
+  template <typename T>
+  void write(const T value) {
+    memcpy(_data + _bytes, &value, sizeof(value));
+    _bytes += sizeof(value);
+  }
+
+  template <typename CoordType>
+  void writeCoord(const int32_t value) {
+    write(static_cast<CoordType>(value));
+  }
+
+  uint32_t getBytes() const {
+    return _bytes;
+  }
+
+private:
+  uint8_t *_data;
+  uint32_t _bytes = 0;
+};
+
+class PackedReader {
+public:
+  explicit PackedReader(const uint8_t *data) : _data(data) {}
+
+  template <typename T>
+  T read() {
+    T value;
+    memcpy(&value, _data + _bytes, sizeof(value));
+    _bytes += sizeof(value);
+    return value;
+  }
+
+  template <typename CoordType>
+  int32_t readCoord() {
+    return read<CoordType>();
+  }
+
+  uint32_t getBytes() const {
+    return _bytes;
+  }
+
+private:
+  const uint8_t *_data;
+  uint32_t _bytes = 0;
+};
+
+template <typename CoordType>
+void encodeCoords(const DrawParams &drawParams, const uint16_t header,
+                  PackedWriter &writer) {
+  if (!(HAS_CROP & header)) {
+    writer.writeCoord<CoordType>(drawParams.pos.x);
+    writer.writeCoord<CoordType>(drawParams.pos.y);
+  }
+
+  writer.writeCoord<CoordType>(drawParams.frameRect.x);
+  writer.writeCoord<CoordType>(drawParams.frameRect.y);
+  writer.writeCoord<CoordType>(drawParams.frameRect.w);
+  writer.writeCoord<CoordType>(drawParams.frameRect.h);
+
+  if (HAS_SCALING & header) {
+    writer.writeCoord<CoordType>(drawParams.scaledWidth);
+    writer.writeCoord<CoordType>(drawParams.scaledHeight);
+  }
+
+  if (HAS_CROP & header) {
+    writer.writeCoord<CoordType>(drawParams.frameCropRect.x);
+    writer.writeCoord<CoordType>(drawParams.frameCropRect.y);
+    writer.writeCoord<CoordType>(drawParams.frameCropRect.w);
+    writer.writeCoord<CoordType>(drawParams.frameCropRect.h);
+  }
+
+  if (HAS_ANGLE & header) {
+    writer.writeCoord<CoordType>(drawParams.rotCenter.x);
+    writer.writeCoord<CoordType>(drawParams.rotCenter.y);
+    if (HAS_DOUBLE_ANGLE & header) {
+      writer.write(drawParams.angle);
+    } else {
+      writer.write(static_cast<float>(drawParams.angle));
+    }
+  }
+}
+
+template <typename CoordType>
+void decodeCoords(const uint16_t header, PackedReader &reader,
+                  DrawParams &outDrawParams) {
+  if (!(HAS_CROP & header)) {
+    outDrawParams.pos.x = reader.readCoord<CoordType>();
+    outDrawParams.pos.y = reader.readCoord<CoordType>();
+  }
+
+  outDrawParams.frameRect.x = reader.readCoord<CoordType>();
+  outDrawParams.frameRect.y = reader.readCoord<CoordType>();
+  outDrawParams.frameRect.w = reader.readCoord<CoordType>();
+  outDrawParams.frameRect.h = reader.readCoord<CoordType>();
+
+  if (HAS_SCALING & header) {
+    outDrawParams.scaledWidth = reader.readCoord<CoordType>();
+    outDrawParams.scaledHeight = reader.readCoord<CoordType>();
+  } else {
+    outDrawParams.scaledWidth = 0;
+    outDrawParams.scaledHeight = 0;
+  }
+
+  if (HAS_CROP & header) {
+    outDrawParams.frameCropRect.x = reader.readCoord<CoordType>();
+    outDrawParams.frameCropRect.y = reader.readCoord<CoordType>();
+    outDrawParams.frameCropRect.w = reader.readCoord<CoordType>();
+    outDrawParams.frameCropRect.h = reader.readCoord<CoordType>();
+
+    // not used for drawing, but keep it meaningful
+    outDrawParams.pos.x = outDrawParams.frameCropRect.x;
+    outDrawParams.pos.y = outDrawParams.frameCropRect.y;
+  }
+
+  if (HAS_ANGLE & header) {
+    outDrawParams.rotCenter.x = reader.readCoord<CoordType>();
+    outDrawParams.rotCenter.y = reader.readCoord<CoordType>();
+    outDrawParams.angle = (HAS_DOUBLE_ANGLE & header)
+        ? reader.read<double>() : reader.read<float>();
+  } else {
+    outDrawParams.rotCenter = Points::ZERO;
+    outDrawParams.angle = ZERO_ANGLE;
+  }
+}
+}
+
+uint32_t DrawParamsCodec::encode(const DrawParams &drawParams,
+                                 uint8_t *outData) {
+  const bool hasAngle = (ZERO_ANGLE != drawParams.angle);
+  const bool hasDoubleAngle = hasAngle &&
+      (static_cast<float>(drawParams.angle) != drawParams.angle);
+
+  bool isWide = !fitsInt16(drawParams.frameRect);
+  if (drawParams.hasCrop) {
+    isWide = isWide || !fitsInt16(drawParams.frameCropRect);
+  } else {
+    isWide = isWide || !fitsInt16(drawParams.pos.x) ||
+             !fitsInt16(drawParams.pos.y);
+  }
+  if (drawParams.hasScaling) {
+    isWide = isWide || !fitsInt16(drawParams.scaledWidth) ||
+             !fitsInt16(drawParams.scaledHeight);
+  }
+  if (hasAngle) {
+    isWide = isWide || !fitsInt16(drawParams.rotCenter.x) ||
+             !fitsInt16(drawParams.rotCenter.y);
+  }
+
+  uint16_t header = packWidgetType(drawParams.widgetType);
+  header |= static_cast<uint16_t>(
+      static_cast<uint16_t>(drawParams.widgetFlipType) << FLIP_TYPE_SHIFT);
+  if (drawParams.hasCrop) {
+    header |= HAS_CROP;
+  }
+  if (drawParams.hasScaling) {
+    header |= HAS_SCALING;
+  }
+  if (hasAngle) {
+    header |= HAS_ANGLE;
+  }
+  if (hasDoubleAngle) {
+    header |= HAS_DOUBLE_ANGLE;
+  }
+  if (FULL_OPACITY != drawParams.opacity) {
+    header |= HAS_OPACITY;
+  }
+  if (isWide) {
+    header |= HAS_WIDE_COORDS;
+  }
+  if (0 != drawParams.layer) {
+    header |= HAS_LAYER;
+  }
+
+  PackedWriter writer(outData);
+  writer.write(header);
+
+  if (WidgetType::IMAGE == drawParams.widgetType ||
+      WidgetType::UNKNOWN == drawParams.widgetType) {
+    writer.write(drawParams.rsrcId);
+  } else {
+    writer.write(drawParams.spriteBufferId);
+  }
+
+  if (isWide) {
+    encodeCoords<int32_t>(drawParams, header, writer);
+  } else {
+    encodeCoords<int16_t>(drawParams, header, writer);
+  }
+
+  if (HAS_OPACITY & header) {
+    writer.write(static_cast<uint8_t>(drawParams.opacity));
+  }
+
+  if (HAS_LAYER & header) {
+    writer.write(drawParams.layer);
+  }
+
+  return writer.getBytes();
+}
+
+uint32_t DrawParamsCodec::decode(const uint8_t *data,
+                                 DrawParams &outDrawParams) {
+  PackedReader reader(data);
+  const uint16_t header = reader.read<uint16_t>();
+
+  outDrawParams.widgetType = unpackWidgetType(header);
+  outDrawParams.widgetFlipType = static_cast<WidgetFlipType>(
+      (header & FLIP_TYPE_MASK) >> FLIP_TYPE_SHIFT);
+  outDrawParams.hasCrop = (HAS_CROP & header);
+  outDrawParams.hasScaling = (HAS_SCALING & header);
+
+  if (WidgetType::IMAGE == outDrawParams.widgetType ||
+      WidgetType::UNKNOWN == outDrawParams.widgetType) {
+    outDrawParams.rsrcId = reader.read<uint64_t>();
+    outDrawParams.rsrcHandle = INVALID_RSRC_HANDLE;
+  } else {
+    outDrawParams.rsrcId = 0;
+    outDrawParams.spriteBufferId = reader.read<int32_t>();
+  }
+
+  if (HAS_WIDE_COORDS & header) {
+    decodeCoords<int32_t>(header, reader, outDrawParams);
+  } else {
+    decodeCoords<int16_t>(header, reader, outDrawParams);
+  }
+
+  outDrawParams.opacity = (HAS_OPACITY & header)
+      ? reader.read<uint8_t>() : FULL_OPACITY;
+  outDrawParams.layer = (HAS_LAYER & header) ? reader.read<uint16_t>() : 0;
+
+  return reader.getBytes();
+}
+
+uint64_t DrawParamsCodec::encodeArray(const DrawParams drawParamsArr[],
+                                      const uint32_t size, uint8_t *outData) {
+  uint64_t populatedBytes = 0;
+  for (uint32_t i = 0; i < size; ++i) {
+    populatedBytes += encode(drawParamsArr[i], outData + populatedBytes);
+  }
+
+  return populatedBytes;
+}
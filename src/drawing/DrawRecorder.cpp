@@ -0,0 +1,16 @@
+// Corresponding header
+#include "sdl_utils/drawing/DrawRecorder.h"
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+void DrawRecorder::init(const uint32_t reservedWidgets) {
+  _drawCmds.reserve(reservedWidgets);
+}
+
+void DrawRecorder::addDrawCmds(const std::span<const DrawParams> drawParams) {
+  _drawCmds.insert(_drawCmds.end(), drawParams.begin(), drawParams.end());
+}
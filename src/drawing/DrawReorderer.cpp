@@ -0,0 +1,164 @@
+// Corresponding header
+#include "sdl_utils/drawing/DrawReorderer.h"
+
+// System headers
+#include <algorithm>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/FrameWidgets.h"
+#include "sdl_utils/drawing/GeometryUtils.h"
+
+ErrorCode DrawReorderer::init(const uint32_t maxWidgets) {
+  if (0 == maxWidgets) {
+    LOGERR("Error, maxWidgets can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  _groups.reserve(maxWidgets);
+  resize(maxWidgets);
+
+  return ErrorCode::SUCCESS;
+}
+
+void DrawReorderer::reorder(FrameWidgets &widgets, const uint32_t size,
+                            uint32_t &outSwitchesBefore,
+                            uint32_t &outSwitchesAfter) {
+  outSwitchesBefore = 0;
+  outSwitchesAfter = 0;
+  if (0 == size) {
+    return;
+  }
+
+  // the frame could be bigger than the initial capacity
+  // (for example FBO updates)
+  if (size > _boundaries.size()) {
+    resize(size);
+  }
+
+  SDL_Texture * const * textures = widgets.texture.data();
+  _groups.clear();
+  for (uint32_t i = 0; i < size; ++i) {
+    if ((0 != i) && (textures[i] != textures[i - 1])) {
+      ++outSwitchesBefore;
+    }
+
+    const Rectangle &boundary =
+        (_boundaries[i] = widgets.getDrawBoundary(i));
+    const int32_t node = static_cast<int32_t>(i);
+    _nextNode[i] = INVALID_NODE;
+
+    const int32_t groupsCount = static_cast<int32_t>(_groups.size());
+    const int32_t lastSearchedGroup =
+        std::max(0, groupsCount - MAX_LOOKBEHIND_GROUPS);
+    int32_t targetGroup = INVALID_NODE;
+
+    for (int32_t groupIdx = groupsCount - 1; groupIdx >= lastSearchedGroup;
+         --groupIdx) {
+      if (textures[i] == _groups[groupIdx].texture) {
+        targetGroup = groupIdx;
+        break;
+      }
+
+      // the widget can not be drawn before an overlapping widget
+      if (overlapsGroup(_groups[groupIdx], boundary)) {
+        break;
+      }
+    }
+
+    if (INVALID_NODE == targetGroup) {
+      Group group;
+      group.texture = textures[i];
+      group.boundary = boundary;
+      group.firstNode = node;
+      group.lastNode = node;
+      _groups.push_back(group);
+      continue;
+    }
+
+    Group &group = _groups[targetGroup];
+    _nextNode[group.lastNode] = node;
+    group.lastNode = node;
+
+    // empty boundaries do not contribute to the union
+    if ((0 != boundary.w) && (0 != boundary.h)) {
+      if ((0 == group.boundary.w) || (0 == group.boundary.h)) {
+        group.boundary = boundary;
+      } else {
+        const int32_t minX = std::min(group.boundary.x, boundary.x);
+        const int32_t minY = std::min(group.boundary.y, boundary.y);
+        const int32_t maxX = std::max(group.boundary.x + group.boundary.w,
+                                      boundary.x + boundary.w);
+        const int32_t maxY = std::max(group.boundary.y + group.boundary.h,
+                                      boundary.y + boundary.h);
+        group.boundary = Rectangle(minX, minY, maxX - minX, maxY - minY);
+      }
+    }
+  }
+
+  outSwitchesAfter = static_cast<uint32_t>(_groups.size()) - 1;
+  if (outSwitchesAfter == outSwitchesBefore) {
+    return; // nothing was moved
+  }
+
+  uint32_t drawIdx = 0;
+  for (const Group &group : _groups) {
+    for (int32_t node = group.firstNode; INVALID_NODE != node;
+         node = _nextNode[node]) {
+      _drawOrder[drawIdx] = static_cast<uint32_t>(node);
+      ++drawIdx;
+    }
+  }
+  applyDrawOrder(widgets, size);
+}
+
+void DrawReorderer::resize(const uint32_t size) {
+  _boundaries.resize(size);
+  _nextNode.resize(size, INVALID_NODE);
+  _drawOrder.resize(size);
+  _rowPosition.resize(size);
+  _positionRow.resize(size);
+}
+
+bool DrawReorderer::overlapsGroup(const Group &group,
+                                  const Rectangle &boundary) const {
+  if (!GeometryUtils::hasRectIntersection(group.boundary, boundary)) {
+    return false;
+  }
+
+  for (int32_t node = group.firstNode; INVALID_NODE != node;
+       node = _nextNode[node]) {
+    if (GeometryUtils::hasRectIntersection(_boundaries[node], boundary)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void DrawReorderer::applyDrawOrder(FrameWidgets &widgets,
+                                   const uint32_t size) {
+  for (uint32_t i = 0; i < size; ++i) {
+    _rowPosition[i] = i;
+    _positionRow[i] = i;
+  }
+
+  for (uint32_t pos = 0; pos < size; ++pos) {
+    const uint32_t wantedRow = _drawOrder[pos];
+    const uint32_t wantedRowPos = _rowPosition[wantedRow];
+    if (wantedRowPos == pos) {
+      continue;
+    }
+
+    widgets.swapRows(pos, wantedRowPos);
+
+    // the displaced row takes the old place of the wanted one
+    const uint32_t displacedRow = _positionRow[pos];
+    _rowPosition[displacedRow] = wantedRowPos;
+    _positionRow[wantedRowPos] = displacedRow;
+    _rowPosition[wantedRow] = pos;
+    _positionRow[pos] = wantedRow;
+  }
+}
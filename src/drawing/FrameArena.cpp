@@ -0,0 +1,66 @@
+// Corresponding header
+#include "sdl_utils/drawing/FrameArena.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+uint64_t alignUp(const uint64_t value, const uint64_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+}
+
+ErrorCode FrameArena::init(const uint64_t capacity) {
+  if (0 == capacity) {
+    LOGERR("Error, FrameArena capacity can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  _block = std::make_unique<uint8_t[]>(capacity);
+  _capacity = capacity;
+  _usedBytes = 0;
+
+  return ErrorCode::SUCCESS;
+}
+
+void *FrameArena::allocate(const uint64_t bytes, const uint64_t alignment) {
+  // the block itself is aligned to alignof(std::max_align_t)
+  const uint64_t offset = alignUp(_usedBytes, alignment);
+  if ((offset <= _capacity) && (bytes <= _capacity - offset)) {
+    _usedBytes = offset + bytes;
+    return _block.get() + offset;
+  }
+
+  // serve the request from a separate block. The worst case padding
+  // is reserved, so the request could be aligned
+  const uint64_t overflowBytes = bytes + alignment;
+  _overflowBlocks.push_back(std::make_unique<uint8_t[]>(overflowBytes));
+  _overflowBytes += overflowBytes;
+  ++_heapAllocations;
+
+  const uintptr_t address =
+      reinterpret_cast<uintptr_t>(_overflowBlocks.back().get());
+  return reinterpret_cast<void*>(alignUp(address, alignment));
+}
+
+void FrameArena::reset() {
+  if (!_overflowBlocks.empty()) {
+    // grow to the frame high-water mark, so the next frames fit
+    _capacity = _usedBytes + _overflowBytes;
+    _block = std::make_unique<uint8_t[]>(_capacity);
+    ++_heapAllocations;
+
+    _overflowBlocks.clear();
+  }
+
+  _lastFrameUsedBytes = _usedBytes + _overflowBytes;
+  _lastFrameHeapAllocations = _heapAllocations;
+
+  _usedBytes = 0;
+  _overflowBytes = 0;
+  _heapAllocations = 0;
+}
@@ -0,0 +1,139 @@
+// Corresponding header
+#include "sdl_utils/drawing/FrameCaptureReader.h"
+
+// System headers
+#include <algorithm>
+#include <cstring>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/DrawParamsCodec.h"
+
+ErrorCode FrameCaptureReader::open(const std::string &file) {
+  _ifstr.open(file, std::ios::binary);
+  if (!_ifstr) {
+    LOGERR("Error, could not open frame capture file: [%s]", file.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  char magic[sizeof(FRAME_CAPTURE_MAGIC)] { };
+  _ifstr.read(magic, sizeof(magic));
+  if (!_ifstr ||
+      (0 != std::memcmp(magic, FRAME_CAPTURE_MAGIC, sizeof(magic)))) {
+    LOGERR("Error, [%s] is not a frame capture file", file.c_str());
+    close();
+    return ErrorCode::FAILURE;
+  }
+
+  const bool isHeaderRead = read(_header.version) &&
+                            read(_header.framesCount) &&
+                            read(_header.windowWidth) &&
+                            read(_header.windowHeight) &&
+                            read(_header.maxFrameWidgets) &&
+                            read(_header.maxFrameRendererCmds) &&
+                            read(_header.maxFrameDataBytes);
+  if (!isHeaderRead) {
+    LOGERR("Error, frame capture file: [%s] has truncated header",
+           file.c_str());
+    close();
+    return ErrorCode::FAILURE;
+  }
+
+  if (FRAME_CAPTURE_VERSION != _header.version) {
+    LOGERR("Error, unsupported frame capture version: %u. Expected: %u",
+           _header.version, FRAME_CAPTURE_VERSION);
+    close();
+    return ErrorCode::FAILURE;
+  }
+
+  _firstFramePos = _ifstr.tellg();
+  _readFrames = 0;
+
+  return ErrorCode::SUCCESS;
+}
+
+void FrameCaptureReader::close() {
+  _ifstr.close();
+  _readFrames = 0;
+}
+
+void FrameCaptureReader::rewind() {
+  _ifstr.clear();
+  _ifstr.seekg(_firstFramePos);
+  _readFrames = 0;
+}
+
+bool FrameCaptureReader::readFrame(CapturedFrame &outFrame) {
+  if (!_ifstr.is_open() || (_header.framesCount == _readFrames)) {
+    return false;
+  }
+
+  uint32_t cmdsCount = 0;
+  uint32_t widgetsCount = 0;
+  uint64_t dataBytes = 0;
+  uint64_t encodedBytes = 0;
+  uint8_t isLocked = 0;
+  const bool isFrameHeaderRead = read(cmdsCount) && read(widgetsCount) &&
+                                 read(dataBytes) && read(encodedBytes) &&
+                                 read(outFrame.globalOffsetX) &&
+                                 read(outFrame.globalOffsetY) &&
+                                 read(isLocked);
+  if (!isFrameHeaderRead ||
+      (cmdsCount > _header.maxFrameRendererCmds) ||
+      (widgetsCount > _header.maxFrameWidgets) ||
+      (dataBytes > _header.maxFrameDataBytes) ||
+      (encodedBytes >
+       static_cast<uint64_t>(widgetsCount) * DrawParamsCodec::MAX_ENCODED_SIZE)) {
+    LOGERR("Error, corrupted frame capture record for frame: %u",
+           _readFrames);
+    return false;
+  }
+  outFrame.isLocked = isLocked;
+
+  outFrame.rendererCmds.resize(cmdsCount);
+  outFrame.renderData.resize(dataBytes);
+  // keep a zeroed tail, so a corrupted record can not be decoded
+  // outside of the buffer
+  _encodedWidgets.assign(encodedBytes + DrawParamsCodec::MAX_ENCODED_SIZE, 0);
+
+  _ifstr.read(reinterpret_cast<char*>(outFrame.rendererCmds.data()),
+              cmdsCount * sizeof(RendererCmd));
+  _ifstr.read(reinterpret_cast<char*>(outFrame.renderData.data()),
+              static_cast<std::streamsize>(dataBytes));
+  _ifstr.read(reinterpret_cast<char*>(_encodedWidgets.data()),
+              static_cast<std::streamsize>(encodedBytes));
+  if (!_ifstr) {
+    LOGERR("Error, truncated frame capture record for frame: %u",
+           _readFrames);
+    return false;
+  }
+
+  const auto isCmdInvalid = [](const RendererCmd cmd) {
+    return RENDERER_CMDS_COUNT <= static_cast<uint32_t>(cmd);
+  };
+  if (std::any_of(outFrame.rendererCmds.begin(), outFrame.rendererCmds.end(),
+                  isCmdInvalid)) {
+    LOGERR("Error, unknown RendererCmd in frame capture record for frame: %u",
+           _readFrames);
+    return false;
+  }
+
+  outFrame.widgets.resize(widgetsCount);
+  uint64_t parsedBytes = 0;
+  for (uint32_t i = 0; (i < widgetsCount) && (parsedBytes <= encodedBytes);
+       ++i) {
+    parsedBytes += DrawParamsCodec::decode(
+        _encodedWidgets.data() + parsedBytes, outFrame.widgets[i]);
+  }
+
+  if (parsedBytes != encodedBytes) {
+    LOGERR("Error, corrupted widgets in frame capture record for frame: %u",
+           _readFrames);
+    return false;
+  }
+
+  ++_readFrames;
+  return true;
+}
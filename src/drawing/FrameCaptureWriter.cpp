@@ -0,0 +1,131 @@
+// Corresponding header
+#include "sdl_utils/drawing/FrameCaptureWriter.h"
+
+// System headers
+#include <algorithm>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/DrawParamsCodec.h"
+#include "sdl_utils/drawing/RendererState.h"
+
+FrameCaptureWriter::~FrameCaptureWriter() noexcept {
+  close();
+}
+
+ErrorCode FrameCaptureWriter::open(const std::string &file,
+                                   const uint32_t framesCount,
+                                   const int32_t windowWidth,
+                                   const int32_t windowHeight) {
+  if (isOpen()) {
+    LOGERR("Error, frame capture is already in progress");
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 == framesCount) {
+    LOGERR("Error, at least a single frame should be captured");
+    return ErrorCode::FAILURE;
+  }
+
+  _ofstr.open(file, std::ios::binary | std::ios::trunc);
+  if (!_ofstr) {
+    LOGERR("Error, could not open frame capture file: [%s]", file.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  _header = FrameCaptureHeader();
+  _header.windowWidth = windowWidth;
+  _header.windowHeight = windowHeight;
+  _requestedFramesCount = framesCount;
+  _isRecording = false;
+
+  // reserve the space. It is rewritten with the final values on ::close()
+  writeHeader();
+
+  return ErrorCode::SUCCESS;
+}
+
+void FrameCaptureWriter::close() {
+  if (!isOpen()) {
+    return;
+  }
+
+  _ofstr.seekp(0);
+  writeHeader();
+  _ofstr.close();
+
+  LOG("Frame capture finished with %u frames", _header.framesCount);
+
+  _isRecording = false;
+  _frameData.clear();
+}
+
+void FrameCaptureWriter::finishFrame(const RendererState &state) {
+  if (!_isRecording) {
+    // the frame has been populated before the capture started
+    _isRecording = true;
+    return;
+  }
+
+  const uint32_t widgetsCount = state.currWidgetCounter;
+  const uint64_t maxEncodedBytes =
+      static_cast<uint64_t>(widgetsCount) * DrawParamsCodec::MAX_ENCODED_SIZE;
+  if (maxEncodedBytes > _encodedWidgets.size()) {
+    _encodedWidgets.resize(maxEncodedBytes);
+  }
+
+  uint64_t encodedBytes = 0;
+  for (uint32_t i = 0; i < widgetsCount; ++i) {
+    encodedBytes += DrawParamsCodec::encode(state.widgets.getDrawParams(i),
+        _encodedWidgets.data() + encodedBytes);
+  }
+
+  const uint32_t cmdsCount = state.currRendererCmdsCounter;
+  const uint64_t dataBytes = _frameData.size();
+
+  write(cmdsCount);
+  write(widgetsCount);
+  write(dataBytes);
+  write(encodedBytes);
+  write(state.globalOffsetX);
+  write(state.globalOffsetY);
+  write(static_cast<uint8_t>(state.isLocked));
+  _ofstr.write(reinterpret_cast<const char*>(state.rendererCmd.data()),
+               cmdsCount * sizeof(RendererCmd));
+  _ofstr.write(reinterpret_cast<const char*>(_frameData.data()),
+               static_cast<std::streamsize>(dataBytes));
+  _ofstr.write(reinterpret_cast<const char*>(_encodedWidgets.data()),
+               static_cast<std::streamsize>(encodedBytes));
+  _frameData.clear();
+
+  if (!_ofstr) {
+    LOGERR("Error, writing to the frame capture file failed. Aborting the "
+           "frame capture");
+    _ofstr.close();
+    _isRecording = false;
+    return;
+  }
+
+  ++_header.framesCount;
+  _header.maxFrameWidgets = std::max(_header.maxFrameWidgets, widgetsCount);
+  _header.maxFrameRendererCmds =
+      std::max(_header.maxFrameRendererCmds, cmdsCount);
+  _header.maxFrameDataBytes = std::max(_header.maxFrameDataBytes, dataBytes);
+
+  if (_requestedFramesCount == _header.framesCount) {
+    close();
+  }
+}
+
+void FrameCaptureWriter::writeHeader() {
+  _ofstr.write(FRAME_CAPTURE_MAGIC, sizeof(FRAME_CAPTURE_MAGIC));
+  write(_header.version);
+  write(_header.framesCount);
+  write(_header.windowWidth);
+  write(_header.windowHeight);
+  write(_header.maxFrameWidgets);
+  write(_header.maxFrameRendererCmds);
+  write(_header.maxFrameDataBytes);
+}
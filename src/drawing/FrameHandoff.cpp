@@ -0,0 +1,334 @@
+// Corresponding header
+#include "sdl_utils/drawing/FrameHandoff.h"
+
+// System headers
+#include <thread>
+#include <utility>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+/** Number of busy-wait iterations before the thread is parked.
+ *  A frame handoff in steady state is expected to be resolved in the
+ *  spinning phase.
+ *
+ *  NOTE: spinning is disabled on single core machines, because the other
+ *        thread can not make progress while the current one is spinning.
+ * */
+constexpr uint32_t SPIN_ITERATIONS = 2048;
+
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+/** @brief spins for a short period and then parks the calling thread on
+ *         the provided counter until the predicate is satisfied.
+ *
+ *  @param std::atomic<uint32_t> & - counter written by the other thread
+ *  @param std::atomic<bool> &     - parked flag of the calling thread
+ *  @param std::atomic<bool> &     - shutdown flag
+ *  @param const uint32_t          - busy-wait iterations before parking
+ *  @param Predicate               - condition, evaluated on counter value
+ *
+ *  @return bool                   - false on shutdown
+ * */
+template <typename Predicate>
+bool spinThenPark(std::atomic<uint32_t> &counter, std::atomic<bool> &isParked,
+                  const std::atomic<bool> &isShutdowned,
+                  const uint32_t spinIterations, Predicate pred) {
+  uint32_t observed = counter.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < spinIterations; ++i) {
+    if (pred(observed)) {
+      return true;
+    }
+    if (isShutdowned.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    cpuRelax();
+    observed = counter.load(std::memory_order_acquire);
+  }
+
+  while (true) {
+    if (isShutdowned.load(std::memory_order_acquire)) {
+      return false;
+    }
+    if (pred(observed)) {
+      return true;
+    }
+
+    /** The parked flag store and the counter load must be sequentially
+     *  consistent with the counter store and the parked flag load
+     *  on the other side. This guarantees that either the re-check below
+     *  observes the new value or the other side observes the parked flag
+     *  and issues a notify.
+     * */
+    isParked.store(true, std::memory_order_seq_cst);
+    observed = counter.load(std::memory_order_seq_cst);
+    if (!pred(observed) && !isShutdowned.load(std::memory_order_seq_cst)) {
+      counter.wait(observed, std::memory_order_seq_cst);
+    }
+    isParked.store(false, std::memory_order_relaxed);
+    observed = counter.load(std::memory_order_acquire);
+  }
+}
+}
+
+ErrorCode FrameHandoff::init(const FrameHandoffPolicy policy,
+                             const uint32_t slotsCount) {
+  if ((MIN_RENDERER_PIPELINE_DEPTH > slotsCount) ||
+      (MAX_RENDERER_PIPELINE_DEPTH < slotsCount)) {
+    LOGERR("Error, FrameHandoff supports [%u - %u] slots, received: %u",
+           MIN_RENDERER_PIPELINE_DEPTH, MAX_RENDERER_PIPELINE_DEPTH,
+           slotsCount);
+    return ErrorCode::FAILURE;
+  }
+
+  _policy = policy;
+  _slotsCount = slotsCount;
+  for (uint32_t i = 0; i < _slotsCount; ++i) {
+    _slotOrder[i] = i;
+  }
+  _spinIterations =
+      (1 < std::thread::hardware_concurrency()) ? SPIN_ITERATIONS : 0;
+  _maxFramesInFlight = slotsCount - 1;
+  _publishedFrames.value.store(0, std::memory_order_relaxed);
+  _releasedFrames.value.store(0, std::memory_order_relaxed);
+  _acquiredFrames.value.store(0, std::memory_order_relaxed);
+  _isProducerParked.store(false, std::memory_order_relaxed);
+  _isConsumerParked.store(false, std::memory_order_relaxed);
+  _isShutdowned.store(false, std::memory_order_relaxed);
+
+  return ErrorCode::SUCCESS;
+}
+
+bool FrameHandoff::waitForFreeSlot_UT() {
+  if (FrameHandoffPolicy::LOCK_FREE == _policy) {
+    return waitForFreeSlotLockFree();
+  }
+
+  return waitForFreeSlotCondVar();
+}
+
+void FrameHandoff::publishFrame_UT() {
+  // only the update thread writes _publishedFrames
+  const uint32_t published =
+      _publishedFrames.value.load(std::memory_order_relaxed) + 1;
+
+  if (FrameHandoffPolicy::LOCK_FREE == _policy) {
+    _publishedFrames.value.store(published, std::memory_order_seq_cst);
+    if (_isConsumerParked.load(std::memory_order_seq_cst)) {
+      _publishedFrames.value.notify_one();
+    }
+    return;
+  }
+
+  std::unique_lock<std::mutex> updateLock(_updateMutex);
+  _publishedFrames.value.store(published, std::memory_order_relaxed);
+
+  // manually unlock the mutex before notifying the renderer thread
+  updateLock.unlock();
+
+  // wake the renderer thread that is sleeping on the condition variable
+  _updateCondVar.notify_one();
+}
+
+uint32_t FrameHandoff::waitForFrame_RT() {
+  // only the renderer thread writes _acquiredFrames
+  const uint32_t acquired =
+      _acquiredFrames.value.load(std::memory_order_relaxed);
+
+  if (FrameHandoffPolicy::LOCK_FREE == _policy) {
+    acquireFrameLockFree(acquired);
+  } else {
+    std::unique_lock<std::mutex> updateLock(_updateMutex);
+
+    /** Condition variables can be subject to spurious wake-ups,
+     *  so it is important to check the actual condition
+     *  being waited for when the call to wait returns
+     * */
+    while (acquired == _publishedFrames.value.load(std::memory_order_relaxed)) {
+      _updateCondVar.wait(updateLock);
+    }
+
+    // acquire under the lock, so the frame can not be replaced meanwhile
+    _acquiredFrames.value.store(acquired + 1, std::memory_order_relaxed);
+  }
+
+  return _slotOrder[acquired % _slotsCount];
+}
+
+void FrameHandoff::releaseFrame_RT() {
+  const uint32_t released =
+      _releasedFrames.value.load(std::memory_order_relaxed) + 1;
+
+  if (FrameHandoffPolicy::LOCK_FREE == _policy) {
+    _releasedFrames.value.store(released, std::memory_order_seq_cst);
+    if (_isProducerParked.load(std::memory_order_seq_cst)) {
+      _releasedFrames.value.notify_one();
+    }
+    return;
+  }
+
+  std::unique_lock<std::mutex> renderLock(_renderMutex);
+  _releasedFrames.value.store(released, std::memory_order_relaxed);
+  renderLock.unlock();
+
+  // wake the update thread that is sleeping on the condition variable
+  _renderCondVar.notify_one();
+}
+
+void FrameHandoff::shutdown_RT() {
+  if (FrameHandoffPolicy::LOCK_FREE == _policy) {
+    _isShutdowned.store(true, std::memory_order_seq_cst);
+
+    // the parked update thread waits for the counter value to change
+    _releasedFrames.value.fetch_add(1, std::memory_order_seq_cst);
+    _releasedFrames.value.notify_one();
+    return;
+  }
+
+  std::unique_lock<std::mutex> renderLock(_renderMutex);
+  _isShutdowned.store(true, std::memory_order_relaxed);
+  renderLock.unlock();
+
+  // wake the update thread that is sleeping on the condition variable
+  _renderCondVar.notify_one();
+}
+
+uint32_t FrameHandoff::getFramesInFlight() const {
+  return _publishedFrames.value.load(std::memory_order_acquire) -
+         _releasedFrames.value.load(std::memory_order_acquire);
+}
+
+bool FrameHandoff::hasFreeSlot_UT() const {
+  return hasFreeSlot(_publishedFrames.value.load(std::memory_order_relaxed),
+                     _releasedFrames.value.load(std::memory_order_acquire));
+}
+
+bool FrameHandoff::replacePendingFrame_UT() {
+  // only the update thread writes _publishedFrames
+  const uint32_t published =
+      _publishedFrames.value.load(std::memory_order_relaxed);
+
+  if (FrameHandoffPolicy::LOCK_FREE == _policy) {
+    if (!replacePendingFrameLockFree(published)) {
+      return false;
+    }
+  } else {
+    std::lock_guard<std::mutex> updateLock(_updateMutex);
+    if (published == _acquiredFrames.value.load(std::memory_order_relaxed)) {
+      return false; // no pending frames
+    }
+    _publishedFrames.value.store(published - 1, std::memory_order_relaxed);
+  }
+
+  /** The populated update thread slot takes the position of the taken back
+   *  frame. The slot of the taken back frame becomes the update thread slot.
+   * */
+  const uint32_t pendingPos = (published - 1) % _slotsCount;
+  const uint32_t updatePos = published % _slotsCount;
+  std::swap(_slotOrder[pendingPos], _slotOrder[updatePos]);
+
+  return true;
+}
+
+uint32_t FrameHandoff::getUpdateSlot_UT() const {
+  return _slotOrder[_publishedFrames.value.load(std::memory_order_relaxed) %
+                    _slotsCount];
+}
+
+uint32_t FrameHandoff::getNewestPublishedSlot_UT() const {
+  return _slotOrder[
+      (_publishedFrames.value.load(std::memory_order_relaxed) - 1) %
+      _slotsCount];
+}
+
+bool FrameHandoff::waitForFreeSlotCondVar() {
+  const uint32_t published =
+      _publishedFrames.value.load(std::memory_order_relaxed);
+
+  // acquire lock for render mutex
+  std::unique_lock<std::mutex> renderLock(_renderMutex);
+
+  /** Condition variables can be subject to spurious wake-ups,
+   *  so it is important to check the actual condition
+   *  being waited for when the call to wait returns
+   * */
+  while (!_isShutdowned.load(std::memory_order_relaxed) &&
+         !hasFreeSlot(published,
+             _releasedFrames.value.load(std::memory_order_relaxed))) {
+    _renderCondVar.wait(renderLock);
+  }
+
+  return !_isShutdowned.load(std::memory_order_relaxed);
+}
+
+bool FrameHandoff::waitForFreeSlotLockFree() {
+  const uint32_t published =
+      _publishedFrames.value.load(std::memory_order_relaxed);
+
+  return spinThenPark(_releasedFrames.value, _isProducerParked, _isShutdowned,
+      _spinIterations, [this, published](const uint32_t released) {
+        return hasFreeSlot(published, released);
+      });
+}
+
+void FrameHandoff::acquireFrameLockFree(const uint32_t acquiredFrames) {
+  // the renderer thread is the one that issues the shutdown
+  // so it can not be waken up by it
+  const std::atomic<bool> neverShutdowned { false };
+
+  while (true) {
+    spinThenPark(_publishedFrames.value, _isConsumerParked, neverShutdowned,
+        _spinIterations, [acquiredFrames](const uint32_t published) {
+          return published != acquiredFrames;
+        });
+
+    /** Claim the frame. The claim races with a possible
+     *  ::replacePendingFrame_UT() from the update thread. Both sides store
+     *  their counter and then load the counter of the other side
+     *  (sequentially consistent), so at least one of them observes the other.
+     * */
+    _acquiredFrames.value.store(acquiredFrames + 1, std::memory_order_seq_cst);
+    if (acquiredFrames !=
+        _publishedFrames.value.load(std::memory_order_seq_cst)) {
+      return;
+    }
+
+    // the frame was taken back by the update thread -> roll back the claim
+    _acquiredFrames.value.store(acquiredFrames, std::memory_order_seq_cst);
+  }
+}
+
+bool FrameHandoff::replacePendingFrameLockFree(const uint32_t publishedFrames) {
+  if (publishedFrames ==
+      _acquiredFrames.value.load(std::memory_order_seq_cst)) {
+    return false; // no pending frames
+  }
+
+  _publishedFrames.value.store(publishedFrames - 1, std::memory_order_seq_cst);
+  if (publishedFrames !=
+      _acquiredFrames.value.load(std::memory_order_seq_cst)) {
+    return true;
+  }
+
+  // the renderer thread has already claimed the frame -> restore it
+  _publishedFrames.value.store(publishedFrames, std::memory_order_seq_cst);
+  if (_isConsumerParked.load(std::memory_order_seq_cst)) {
+    _publishedFrames.value.notify_one();
+  }
+
+  return false;
+}
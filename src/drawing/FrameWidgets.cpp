@@ -0,0 +1,325 @@
+// Corresponding header
+#include "sdl_utils/drawing/FrameWidgets.h"
+
+// System headers
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/GeometryUtils.h"
+
+namespace {
+void addToColumn(int32_t *column, const uint32_t size, const int32_t value) {
+  uint32_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i offset = _mm256_set1_epi32(value);
+  for (; i + 8 <= size; i += 8) {
+    __m256i *ptr = reinterpret_cast<__m256i*>(column + i);
+    _mm256_storeu_si256(ptr, _mm256_add_epi32(_mm256_loadu_si256(ptr), offset));
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  const __m128i offset = _mm_set1_epi32(value);
+  for (; i + 4 <= size; i += 4) {
+    __m128i *ptr = reinterpret_cast<__m128i*>(column + i);
+    _mm_storeu_si128(ptr, _mm_add_epi32(_mm_loadu_si128(ptr), offset));
+  }
+#endif /* defined(__AVX2__) */
+
+  // scalar fallback and tail
+  for (; i < size; ++i) {
+    column[i] += value;
+  }
+}
+
+// multiply-xorshift mixing, processing 8 bytes per step
+uint64_t hashBytes(uint64_t hash, const void *data, const size_t bytes) {
+  constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+  const uint8_t *ptr = static_cast<const uint8_t*>(data);
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, ptr + i, sizeof(word));
+    hash = (hash ^ word) * MULTIPLIER;
+    hash ^= hash >> 29;
+  }
+
+  uint64_t tail = 0;
+  if (i < bytes) {
+    std::memcpy(&tail, ptr + i, bytes - i);
+  }
+  hash = (hash ^ tail ^ bytes) * MULTIPLIER;
+  return hash ^ (hash >> 32);
+}
+
+template <typename T, typename Allocator>
+uint64_t hashColumn(const uint64_t hash,
+                    const std::vector<T, Allocator> &column,
+                    const uint32_t size) {
+  return hashBytes(hash, column.data(), size * sizeof(T));
+}
+}
+
+ErrorCode FrameWidgets::init(const uint32_t capacity) {
+  if (0 == capacity) {
+    LOGERR("Error, FrameWidgets capacity can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  resize(capacity);
+  return ErrorCode::SUCCESS;
+}
+
+void FrameWidgets::resize(const uint32_t capacity) {
+  x.resize(capacity, 0);
+  y.resize(capacity, 0);
+  width.resize(capacity, 0);
+  height.resize(capacity, 0);
+  visibleWidth.resize(capacity, 0);
+  visibleHeight.resize(capacity, 0);
+
+  srcRect.resize(capacity);
+  containerId.resize(capacity, 0);
+  rsrcHandle.resize(capacity, INVALID_RSRC_HANDLE);
+  widgetType.resize(capacity, WidgetType::UNKNOWN);
+  opacity.resize(capacity, FULL_OPACITY);
+  layer.resize(capacity, 0);
+  flags.resize(capacity, NO_FLAGS);
+  texture.resize(capacity, nullptr);
+
+  angle.resize(capacity, ZERO_ANGLE);
+  rotCenter.resize(capacity);
+  flipType.resize(capacity, WidgetFlipType::NONE);
+}
+
+void FrameWidgets::setDrawParams(const uint32_t idx,
+                                 const DrawParams &drawParams) {
+  int32_t quadW = 0;
+  int32_t quadH = 0;
+
+  if (drawParams.hasCrop) {
+    x[idx] = drawParams.frameCropRect.x;
+    y[idx] = drawParams.frameCropRect.y;
+    quadW = drawParams.frameCropRect.w;
+    quadH = drawParams.frameCropRect.h;
+    visibleWidth[idx] = quadW;
+    visibleHeight[idx] = quadH;
+
+    // crop with no common intersection is not drawn at all
+    if (drawParams.hasScaling && (0 != quadW) && (0 != quadH)) {
+      quadW = std::max(quadW, drawParams.scaledWidth);
+      quadH = std::max(quadH, drawParams.scaledHeight);
+    }
+  } else {
+    x[idx] = drawParams.pos.x;
+    y[idx] = drawParams.pos.y;
+    quadW = drawParams.hasScaling ? drawParams.scaledWidth
+                                  : drawParams.frameRect.w;
+    quadH = drawParams.hasScaling ? drawParams.scaledHeight
+                                  : drawParams.frameRect.h;
+    visibleWidth[idx] = quadW;
+    visibleHeight[idx] = quadH;
+  }
+  width[idx] = quadW;
+  height[idx] = quadH;
+
+  uint8_t rowFlags = NO_FLAGS;
+  if (ZERO_ANGLE != drawParams.angle) {
+    rowFlags |= IS_ROTATED;
+  }
+  if ((visibleWidth[idx] < quadW) || (visibleHeight[idx] < quadH)) {
+    rowFlags |= IS_CLIPPED;
+  }
+  flags[idx] = rowFlags;
+
+  srcRect[idx] = drawParams.frameRect;
+  containerId[idx] = (WidgetType::IMAGE == drawParams.widgetType)
+      ? drawParams.rsrcId
+      : static_cast<uint64_t>(drawParams.spriteBufferId);
+  rsrcHandle[idx] = (WidgetType::IMAGE == drawParams.widgetType)
+      ? drawParams.rsrcHandle : INVALID_RSRC_HANDLE;
+  widgetType[idx] = drawParams.widgetType;
+  opacity[idx] = drawParams.opacity;
+  layer[idx] = drawParams.layer;
+  texture[idx] = nullptr;
+
+  angle[idx] = drawParams.angle;
+  rotCenter[idx] = drawParams.rotCenter;
+  flipType[idx] = drawParams.widgetFlipType;
+}
+
+DrawParams FrameWidgets::getDrawParams(const uint32_t idx) const {
+  DrawParams drawParams;
+  if (WidgetType::IMAGE == widgetType[idx]) {
+    drawParams.rsrcId = containerId[idx];
+    drawParams.rsrcHandle = rsrcHandle[idx];
+  } else {
+    drawParams.spriteBufferId = static_cast<int32_t>(containerId[idx]);
+  }
+  drawParams.pos = Point(x[idx], y[idx]);
+  drawParams.rotCenter = rotCenter[idx];
+  drawParams.angle = angle[idx];
+  drawParams.frameRect = srcRect[idx];
+  drawParams.opacity = opacity[idx];
+  drawParams.layer = layer[idx];
+  drawParams.widgetType = widgetType[idx];
+  drawParams.widgetFlipType = flipType[idx];
+
+  // the destination quad is already resolved -> express it as scaling
+  drawParams.hasScaling = true;
+  drawParams.scaledWidth = width[idx];
+  drawParams.scaledHeight = height[idx];
+
+  // the clip rectangle is expressed as a crop
+  if (IS_CLIPPED & flags[idx]) {
+    drawParams.hasCrop = true;
+    drawParams.frameCropRect =
+        Rectangle(x[idx], y[idx], visibleWidth[idx], visibleHeight[idx]);
+  }
+
+  return drawParams;
+}
+
+void FrameWidgets::applyGlobalOffset(const uint32_t size,
+                                     const int32_t offsetX,
+                                     const int32_t offsetY) {
+  if (0 != offsetX) {
+    addToColumn(x.data(), size, offsetX);
+  }
+
+  if (0 != offsetY) {
+    addToColumn(y.data(), size, offsetY);
+  }
+}
+
+Rectangle FrameWidgets::getDrawBoundary(const uint32_t idx) const {
+  if ((0 == width[idx]) || (0 == height[idx])) {
+    return Rectangles::ZERO;
+  }
+
+  const Rectangle visibleQuad(x[idx], y[idx], visibleWidth[idx],
+                              visibleHeight[idx]);
+  if (!(IS_ROTATED & flags[idx])) {
+    return visibleQuad;
+  }
+
+  const Rectangle quad(x[idx], y[idx], width[idx], height[idx]);
+  const Rectangle boundary =
+      GeometryUtils::getRotatedBoundary(quad, rotCenter[idx], angle[idx]);
+  if (!(IS_CLIPPED & flags[idx])) {
+    return boundary;
+  }
+
+  // the renderer clip rectangle is applied after the rotation
+  Rectangle clipped;
+  if (!GeometryUtils::findRectIntersection(boundary, visibleQuad, clipped)) {
+    return Rectangles::ZERO;
+  }
+  return clipped;
+}
+
+void FrameWidgets::copyRow(const uint32_t dstIdx, const uint32_t srcIdx) {
+  x[dstIdx] = x[srcIdx];
+  y[dstIdx] = y[srcIdx];
+  width[dstIdx] = width[srcIdx];
+  height[dstIdx] = height[srcIdx];
+  visibleWidth[dstIdx] = visibleWidth[srcIdx];
+  visibleHeight[dstIdx] = visibleHeight[srcIdx];
+
+  srcRect[dstIdx] = srcRect[srcIdx];
+  containerId[dstIdx] = containerId[srcIdx];
+  rsrcHandle[dstIdx] = rsrcHandle[srcIdx];
+  widgetType[dstIdx] = widgetType[srcIdx];
+  opacity[dstIdx] = opacity[srcIdx];
+  layer[dstIdx] = layer[srcIdx];
+  flags[dstIdx] = flags[srcIdx];
+  texture[dstIdx] = texture[srcIdx];
+
+  angle[dstIdx] = angle[srcIdx];
+  rotCenter[dstIdx] = rotCenter[srcIdx];
+  flipType[dstIdx] = flipType[srcIdx];
+}
+
+uint64_t FrameWidgets::computeHash(const uint32_t size) const {
+  // the texture and rsrcHandle columns are resolved from containerId
+  // and widgetType
+  uint64_t hash = size;
+  hash = hashColumn(hash, x, size);
+  hash = hashColumn(hash, y, size);
+  hash = hashColumn(hash, width, size);
+  hash = hashColumn(hash, height, size);
+  hash = hashColumn(hash, visibleWidth, size);
+  hash = hashColumn(hash, visibleHeight, size);
+  hash = hashColumn(hash, srcRect, size);
+  hash = hashColumn(hash, containerId, size);
+  hash = hashColumn(hash, widgetType, size);
+  hash = hashColumn(hash, opacity, size);
+  hash = hashColumn(hash, layer, size);
+  hash = hashColumn(hash, flags, size);
+  hash = hashColumn(hash, angle, size);
+  hash = hashColumn(hash, rotCenter, size);
+  hash = hashColumn(hash, flipType, size);
+
+  return hash;
+}
+
+uint64_t FrameWidgets::computeRowHash(const uint32_t idx) const {
+  // gather the row, so it is hashed in 8 byte steps
+  uint8_t row[6 * sizeof(int32_t) + sizeof(Rectangle) + sizeof(uint64_t) +
+              sizeof(WidgetType) + sizeof(int32_t) + sizeof(uint16_t) +
+              sizeof(uint8_t) +
+              sizeof(double) + sizeof(Point) + sizeof(WidgetFlipType)];
+  size_t offset = 0;
+  const auto append = [&row, &offset](const auto &value) {
+    std::memcpy(row + offset, &value, sizeof(value));
+    offset += sizeof(value);
+  };
+
+  append(x[idx]);
+  append(y[idx]);
+  append(width[idx]);
+  append(height[idx]);
+  append(visibleWidth[idx]);
+  append(visibleHeight[idx]);
+  append(srcRect[idx]);
+  append(containerId[idx]);
+  append(widgetType[idx]);
+  append(opacity[idx]);
+  append(layer[idx]);
+  append(flags[idx]);
+  append(angle[idx]);
+  append(rotCenter[idx]);
+  append(flipType[idx]);
+
+  return hashBytes(0, row, offset);
+}
+
+void FrameWidgets::swapRows(const uint32_t idxA, const uint32_t idxB) {
+  std::swap(x[idxA], x[idxB]);
+  std::swap(y[idxA], y[idxB]);
+  std::swap(width[idxA], width[idxB]);
+  std::swap(height[idxA], height[idxB]);
+  std::swap(visibleWidth[idxA], visibleWidth[idxB]);
+  std::swap(visibleHeight[idxA], visibleHeight[idxB]);
+
+  std::swap(srcRect[idxA], srcRect[idxB]);
+  std::swap(containerId[idxA], containerId[idxB]);
+  std::swap(rsrcHandle[idxA], rsrcHandle[idxB]);
+  std::swap(widgetType[idxA], widgetType[idxB]);
+  std::swap(opacity[idxA], opacity[idxB]);
+  std::swap(layer[idxA], layer[idxB]);
+  std::swap(flags[idxA], flags[idxB]);
+  std::swap(texture[idxA], texture[idxB]);
+
+  std::swap(angle[idxA], angle[idxB]);
+  std::swap(rotCenter[idxA], rotCenter[idxB]);
+  std::swap(flipType[idxA], flipType[idxB]);
+}
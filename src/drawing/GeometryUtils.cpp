@@ -2,11 +2,18 @@
 #include "sdl_utils/drawing/GeometryUtils.h"
 
 // System headers
+#include <algorithm>
+#include <cmath>
 
 // Other libraries headers
 #include <SDL_rect.h>
 
 // Own components headers
+#include "sdl_utils/drawing/DrawParams.h"
+
+namespace {
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+}
 
 bool GeometryUtils::findRectIntersection(const Rectangle &srcA,
                                          const Rectangle &srcB,
@@ -16,3 +23,86 @@ bool GeometryUtils::findRectIntersection(const Rectangle &srcA,
                            reinterpret_cast<SDL_Rect *>(&intersectionResult));
 }
 
+
+Rectangle GeometryUtils::getDrawBoundary(const DrawParams &drawParams) {
+  Rectangle quad;
+  bool isClipped = false;
+
+  if (drawParams.hasCrop) {
+    quad = drawParams.frameCropRect;
+
+    if (drawParams.hasScaling) {
+      if ((0 == quad.w) || (0 == quad.h)) {
+        return Rectangles::ZERO;
+      }
+
+      isClipped = (drawParams.scaledWidth > quad.w) ||
+                  (drawParams.scaledHeight > quad.h);
+      quad.w = std::max(quad.w, drawParams.scaledWidth);
+      quad.h = std::max(quad.h, drawParams.scaledHeight);
+    }
+  } else if (drawParams.hasScaling) {
+    quad = Rectangle(drawParams.pos.x, drawParams.pos.y,
+                     drawParams.scaledWidth, drawParams.scaledHeight);
+  } else {
+    quad = Rectangle(drawParams.pos.x, drawParams.pos.y,
+                     drawParams.frameRect.w, drawParams.frameRect.h);
+  }
+
+  if ((0 == quad.w) || (0 == quad.h)) {
+    return Rectangles::ZERO;
+  }
+
+  if (ZERO_ANGLE != drawParams.angle) {
+    quad = getRotatedBoundary(quad, drawParams.rotCenter, drawParams.angle);
+  }
+
+  if (isClipped) {
+    // the renderer clip rectangle is the crop rectangle
+    Rectangle clipped;
+    if (!findRectIntersection(quad, drawParams.frameCropRect, clipped)) {
+      return Rectangles::ZERO;
+    }
+    return clipped;
+  }
+
+  return quad;
+}
+
+Rectangle GeometryUtils::getRotatedBoundary(const Rectangle &quad,
+                                            const Point &rotCenter,
+                                            const double angle) {
+  const double radians = angle * DEG_TO_RAD;
+  const double cosA = std::cos(radians);
+  const double sinA = std::sin(radians);
+  const double centerX = quad.x + rotCenter.x;
+  const double centerY = quad.y + rotCenter.y;
+  const double cornersX[] = { 0.0, 1.0 * quad.w, 1.0 * quad.w, 0.0 };
+  const double cornersY[] = { 0.0, 0.0, 1.0 * quad.h, 1.0 * quad.h };
+
+  double minX = 0.0;
+  double minY = 0.0;
+  double maxX = 0.0;
+  double maxY = 0.0;
+  for (int32_t i = 0; i < 4; ++i) {
+    const double relX = quad.x + cornersX[i] - centerX;
+    const double relY = quad.y + cornersY[i] - centerY;
+    const double x = centerX + (relX * cosA) - (relY * sinA);
+    const double y = centerY + (relX * sinA) + (relY * cosA);
+    if (0 == i) {
+      minX = maxX = x;
+      minY = maxY = y;
+      continue;
+    }
+    minX = std::min(minX, x);
+    maxX = std::max(maxX, x);
+    minY = std::min(minY, y);
+    maxY = std::max(maxY, y);
+  }
+
+  const int32_t boundX = static_cast<int32_t>(std::floor(minX));
+  const int32_t boundY = static_cast<int32_t>(std::floor(minY));
+  return Rectangle(boundX, boundY,
+                   static_cast<int32_t>(std::ceil(maxX)) - boundX,
+                   static_cast<int32_t>(std::ceil(maxY)) - boundY);
+}
@@ -0,0 +1,120 @@
+// Corresponding header
+#include "sdl_utils/drawing/LayerSorter.h"
+
+// System headers
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Other libraries headers
+
+// Own components headers
+#include "sdl_utils/drawing/FrameArena.h"
+#include "sdl_utils/drawing/FrameWidgets.h"
+
+namespace {
+constexpr uint32_t DIGIT_BITS = 8;
+constexpr uint32_t DIGIT_VALUES = 1 << DIGIT_BITS;
+constexpr uint32_t DIGIT_MASK = DIGIT_VALUES - 1;
+constexpr uint32_t DIGITS_COUNT = (sizeof(uint16_t) * 8) / DIGIT_BITS;
+
+// the biggest FrameWidgets column element
+constexpr size_t MAX_ELEMENT_SIZE = std::max({ sizeof(int32_t),
+    sizeof(Rectangle), sizeof(uint64_t), sizeof(double), sizeof(Point),
+    sizeof(SDL_Texture*) });
+
+uint32_t getDigit(const uint16_t key, const uint32_t digitIdx) {
+  return (key >> (digitIdx * DIGIT_BITS)) & DIGIT_MASK;
+}
+
+// the scratch memory holds at least size * MAX_ELEMENT_SIZE bytes
+template <typename Column>
+void gatherColumn(Column &column, const uint32_t *order, const uint32_t size,
+                  void *scratch) {
+  using T = typename Column::value_type;
+  static_assert(sizeof(T) <= MAX_ELEMENT_SIZE);
+
+  T *sorted = static_cast<T*>(scratch);
+  for (uint32_t i = 0; i < size; ++i) {
+    new (&sorted[i]) T(column[order[i]]);
+  }
+  std::copy(sorted, sorted + size, column.begin());
+}
+}
+
+bool LayerSorter::sort(FrameWidgets &widgets, const uint32_t size,
+                       FrameArena &arena) {
+  const uint16_t *layers = widgets.layer.data();
+
+  // the common case - single layer or already ordered submission
+  bool isSorted = true;
+  for (uint32_t i = 1; i < size; ++i) {
+    if (layers[i] < layers[i - 1]) {
+      isSorted = false;
+      break;
+    }
+  }
+  if (isSorted) {
+    return false;
+  }
+
+  uint32_t histograms[DIGITS_COUNT][DIGIT_VALUES] { };
+  for (uint32_t i = 0; i < size; ++i) {
+    for (uint32_t digitIdx = 0; digitIdx < DIGITS_COUNT; ++digitIdx) {
+      ++histograms[digitIdx][getDigit(layers[i], digitIdx)];
+    }
+  }
+
+  uint32_t *order = arena.allocateArray<uint32_t>(size);
+  uint32_t *scratchOrder = arena.allocateArray<uint32_t>(size);
+  for (uint32_t i = 0; i < size; ++i) {
+    order[i] = i;
+  }
+
+  for (uint32_t digitIdx = 0; digitIdx < DIGITS_COUNT; ++digitIdx) {
+    uint32_t *histogram = histograms[digitIdx];
+
+    // all rows share the digit - the pass would not move anything
+    if (size == histogram[getDigit(layers[0], digitIdx)]) {
+      continue;
+    }
+
+    // turn the counts into the first position of every digit
+    uint32_t position = 0;
+    for (uint32_t digit = 0; digit < DIGIT_VALUES; ++digit) {
+      const uint32_t count = histogram[digit];
+      histogram[digit] = position;
+      position += count;
+    }
+
+    for (uint32_t i = 0; i < size; ++i) {
+      const uint32_t row = order[i];
+      scratchOrder[histogram[getDigit(layers[row], digitIdx)]++] = row;
+    }
+    std::swap(order, scratchOrder);
+  }
+
+  void *scratch = arena.allocate(size * MAX_ELEMENT_SIZE);
+  gatherColumn(widgets.x, order, size, scratch);
+  gatherColumn(widgets.y, order, size, scratch);
+  gatherColumn(widgets.width, order, size, scratch);
+  gatherColumn(widgets.height, order, size, scratch);
+  gatherColumn(widgets.visibleWidth, order, size, scratch);
+  gatherColumn(widgets.visibleHeight, order, size, scratch);
+
+  gatherColumn(widgets.srcRect, order, size, scratch);
+  gatherColumn(widgets.containerId, order, size, scratch);
+  gatherColumn(widgets.rsrcHandle, order, size, scratch);
+  gatherColumn(widgets.widgetType, order, size, scratch);
+  gatherColumn(widgets.opacity, order, size, scratch);
+  gatherColumn(widgets.layer, order, size, scratch);
+  gatherColumn(widgets.flags, order, size, scratch);
+  gatherColumn(widgets.texture, order, size, scratch);
+
+  gatherColumn(widgets.angle, order, size, scratch);
+  gatherColumn(widgets.rotCenter, order, size, scratch);
+  gatherColumn(widgets.flipType, order, size, scratch);
+
+  return true;
+}
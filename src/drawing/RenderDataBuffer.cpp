@@ -0,0 +1,158 @@
+// Corresponding header
+#include "sdl_utils/drawing/RenderDataBuffer.h"
+
+// System headers
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+ErrorCode RenderDataBuffer::init(const uint64_t chunkCapacity) {
+  if (0 == chunkCapacity) {
+    LOGERR("Error, RenderDataBuffer chunk capacity can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  _chunkCapacity = chunkCapacity;
+  _chunks.clear();
+  _capacity = 0;
+  _writeChunk = 0;
+  insertChunk(chunkCapacity);
+
+  _growthsCount = 0;
+  clear();
+
+  return ErrorCode::SUCCESS;
+}
+
+uint64_t RenderDataBuffer::write(const uint8_t *data, const uint64_t bytes) {
+  if (0 == bytes) {
+    return 0;
+  }
+
+  if (bytes > _chunks[_writeChunk].capacity - _chunks[_writeChunk].used) {
+    const size_t nextChunk = _writeChunk + 1;
+    if ((nextChunk == _chunks.size()) ||
+        (bytes > _chunks[nextChunk].capacity)) {
+      insertChunk(std::max(bytes, _chunkCapacity));
+    }
+    _writeChunk = nextChunk;
+  }
+
+  Chunk &chunk = _chunks[_writeChunk];
+  std::memcpy(chunk.data.get() + chunk.used, data, bytes);
+  chunk.used += bytes;
+  _size += bytes;
+
+  return bytes;
+}
+
+uint64_t RenderDataBuffer::read(uint8_t *outData, const uint64_t bytes) {
+  if ((0 == bytes) || (bytes > _size)) {
+    return 0;
+  }
+
+  uint64_t readBytes = 0;
+  size_t chunkIdx = _readChunk;
+  uint64_t chunkPos = _readPos;
+  while (readBytes < bytes) {
+    const Chunk &chunk = _chunks[chunkIdx];
+    const uint64_t bytesToCopy =
+        std::min(bytes - readBytes, chunk.used - chunkPos);
+    std::memcpy(outData + readBytes, chunk.data.get() + chunkPos,
+                bytesToCopy);
+    readBytes += bytesToCopy;
+    ++chunkIdx;
+    chunkPos = 0;
+  }
+
+  return consume(bytes);
+}
+
+const uint8_t *RenderDataBuffer::peekContiguous(const uint64_t bytes) const {
+  if (bytes > _size) {
+    return nullptr;
+  }
+
+  size_t chunkIdx = _readChunk;
+  uint64_t chunkPos = _readPos;
+  // skip the fully read chunks
+  while ((chunkPos == _chunks[chunkIdx].used) && (chunkIdx < _writeChunk)) {
+    ++chunkIdx;
+    chunkPos = 0;
+  }
+
+  const Chunk &chunk = _chunks[chunkIdx];
+  if (bytes > chunk.used - chunkPos) {
+    return nullptr;
+  }
+
+  return chunk.data.get() + chunkPos;
+}
+
+uint64_t RenderDataBuffer::consume(const uint64_t bytes) {
+  if ((0 == bytes) || (bytes > _size)) {
+    return 0;
+  }
+
+  _size -= bytes;
+  if (0 == _size) {
+    // rewind, so the chunks are reused for the next frame
+    clear();
+    return bytes;
+  }
+
+  uint64_t leftBytes = bytes;
+  while (0 < leftBytes) {
+    const uint64_t chunkLeftBytes = _chunks[_readChunk].used - _readPos;
+    if (leftBytes < chunkLeftBytes) {
+      _readPos += leftBytes;
+      break;
+    }
+
+    leftBytes -= chunkLeftBytes;
+    ++_readChunk;
+    _readPos = 0;
+  }
+
+  return bytes;
+}
+
+void RenderDataBuffer::reserve(const uint64_t bytes) {
+  if (bytes <= _capacity) {
+    return;
+  }
+
+  // the chunk is appended after the last one
+  _writeChunk = _chunks.size() - 1;
+  insertChunk(std::max(bytes - _capacity, _chunkCapacity));
+  _writeChunk = 0;
+}
+
+void RenderDataBuffer::clear() {
+  for (size_t i = 0; i <= _writeChunk; ++i) {
+    _chunks[i].used = 0;
+  }
+
+  _size = 0;
+  _writeChunk = 0;
+  _readChunk = 0;
+  _readPos = 0;
+}
+
+void RenderDataBuffer::insertChunk(const uint64_t capacity) {
+  Chunk chunk;
+  chunk.data = std::make_unique<uint8_t[]>(capacity);
+  chunk.capacity = capacity;
+
+  // the chunks are only moved, the stored data stays at the same address
+  const size_t insertPos = _chunks.empty() ? 0 : (_writeChunk + 1);
+  _chunks.insert(_chunks.begin() + static_cast<ptrdiff_t>(insertPos),
+                 std::move(chunk));
+  _capacity += capacity;
+  ++_growthsCount;
+}
@@ -0,0 +1,166 @@
+// Corresponding header
+#include "sdl_utils/drawing/RenderStateCache.h"
+
+// System headers
+#include <cstdlib>
+
+// Other libraries headers
+#include <SDL_render.h>
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+bool isSameRect(const Rectangle &lhs, const Rectangle &rhs) {
+  return (lhs.x == rhs.x) && (lhs.y == rhs.y) &&
+         (lhs.w == rhs.w) && (lhs.h == rhs.h);
+}
+}
+
+void RenderStateCache::reset(SDL_Renderer *renderer) {
+  _renderer = renderer;
+  _target = nullptr;
+  _isTargetKnown = false;
+  _isDrawColorKnown = false;
+  _isCropClipActive = false;
+  _textureAlphaMods.clear();
+  _textureBlendModes.clear();
+  _avoidedCalls = 0;
+}
+
+ErrorCode RenderStateCache::setRenderTarget(SDL_Texture *target) {
+  if (_isTargetKnown && (target == _target)) {
+    ++_avoidedCalls;
+    return ErrorCode::SUCCESS;
+  }
+
+  /** SDL keeps the clip rectangle of the default target, while a texture
+   *  target is used. Don't leave a crop there.
+   * */
+  if (ErrorCode::SUCCESS != resetClipRect()) {
+    return ErrorCode::FAILURE;
+  }
+
+  if (EXIT_SUCCESS != SDL_SetRenderTarget(_renderer, target)) {
+    LOGERR("Error, renderer target could not be set. "
+           "SDL_SetRenderTarget() failed, SDL Error: %s", SDL_GetError());
+    _isTargetKnown = false;
+    return ErrorCode::FAILURE;
+  }
+
+  // the clipping is disabled for texture targets and restored for the
+  // default one
+  _target = target;
+  _isTargetKnown = true;
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode RenderStateCache::setDrawColor(const Color &color) {
+  if (_isDrawColorKnown && (color == _drawColor)) {
+    ++_avoidedCalls;
+    return ErrorCode::SUCCESS;
+  }
+
+  if (EXIT_SUCCESS != SDL_SetRenderDrawColor(_renderer, color.rgba.r,
+          color.rgba.g, color.rgba.b, color.rgba.a)) {
+    LOGERR("Error in, SDL_SetRenderDrawColor(), SDL Error: %s",
+           SDL_GetError());
+    _isDrawColorKnown = false;
+    return ErrorCode::FAILURE;
+  }
+
+  _drawColor = color;
+  _isDrawColorKnown = true;
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode RenderStateCache::setCropClipRect(const Rectangle &clipRect) {
+  if (_isCropClipActive && isSameRect(clipRect, _cropClipRect)) {
+    ++_avoidedCalls;
+    return ErrorCode::SUCCESS;
+  }
+
+  if (EXIT_SUCCESS != SDL_RenderSetClipRect(_renderer,
+          reinterpret_cast<const SDL_Rect*>(&clipRect))) {
+    LOGERR("Error in SDL_RenderSetClipRect, SDL Error: %s", SDL_GetError());
+    return ErrorCode::FAILURE;
+  }
+
+  _cropClipRect = clipRect;
+  _isCropClipActive = true;
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode RenderStateCache::resetClipRect() {
+  if (!_isCropClipActive) {
+    return ErrorCode::SUCCESS;
+  }
+
+  if (EXIT_SUCCESS != SDL_RenderSetClipRect(_renderer,
+          reinterpret_cast<const SDL_Rect*>(&_defaultClipRect))) {
+    LOGERR("Error in SDL_RenderSetClipRect(), SDL Error: %s", SDL_GetError());
+    return ErrorCode::FAILURE;
+  }
+
+  _isCropClipActive = false;
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode RenderStateCache::setTextureAlphaMod(SDL_Texture *texture,
+                                               const uint8_t alpha) {
+  // the common case - opaque draw, while no texture is modulated.
+  // Skip the lookup altogether
+  if ((FULL_OPACITY == alpha) && _textureAlphaMods.empty()) {
+    ++_avoidedCalls;
+    return ErrorCode::SUCCESS;
+  }
+
+  const auto it = _textureAlphaMods.find(texture);
+  if (_textureAlphaMods.end() == it) {
+    // most of the textures are never modulated
+    if (FULL_OPACITY == alpha) {
+      ++_avoidedCalls;
+      return ErrorCode::SUCCESS;
+    }
+  } else if (alpha == it->second) {
+    ++_avoidedCalls;
+    return ErrorCode::SUCCESS;
+  }
+
+  if (EXIT_SUCCESS != SDL_SetTextureAlphaMod(texture, alpha)) {
+    return ErrorCode::FAILURE;
+  }
+
+  if (FULL_OPACITY == alpha) {
+    _textureAlphaMods.erase(it);
+  } else {
+    _textureAlphaMods[texture] = alpha;
+  }
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode RenderStateCache::setTextureBlendMode(SDL_Texture *texture,
+                                                const BlendMode blendMode) {
+  const auto it = _textureBlendModes.find(texture);
+  if ((_textureBlendModes.end() != it) && (blendMode == it->second)) {
+    ++_avoidedCalls;
+    return ErrorCode::SUCCESS;
+  }
+
+  if (EXIT_SUCCESS != SDL_SetTextureBlendMode(texture,
+          static_cast<SDL_BlendMode>(blendMode))) {
+    return ErrorCode::FAILURE;
+  }
+
+  _textureBlendModes[texture] = blendMode;
+  return ErrorCode::SUCCESS;
+}
+
+void RenderStateCache::forgetTexture(SDL_Texture *texture) {
+  _textureAlphaMods.erase(texture);
+  _textureBlendModes.erase(texture);
+
+  if (_isTargetKnown && (texture == _target)) {
+    _isTargetKnown = false;
+  }
+}
@@ -7,63 +7,105 @@
 
 // Other libraries headers
 #include <SDL_hints.h>
+#include <SDL_pixels.h>
 #include <SDL_render.h>
-#include "utils/concurrency/ThreadSafeQueue.h"
+#include <SDL_video.h>
 #include "utils/data_type/EnumClassUtils.h"
 #include "utils/drawing/Color.h"
 #include "utils/log/Log.h"
 
 // Own components headers
 #include "sdl_utils/containers/SDLContainers.h"
+#include "sdl_utils/drawing/DrawParamsCodec.h"
+#include "sdl_utils/drawing/LayerSorter.h"
 #include "sdl_utils/drawing/LoadingScreen.h"
 #include "sdl_utils/drawing/Texture.h"
 
-#define LOCAL_DEBUG 0
-
-#if LOCAL_DEBUG
-namespace {
-constexpr const char* RENDERER_CMD_NAMES[]{
-    "CLEAR_SCREEN",
-    "FINISH_FRAME",
-    "CHANGE_CLEAR_COLOR",
-    "LOAD_TEXTURE_SINGLE",
-    "LOAD_TEXTURE_MULTIPLE",
-    "DESTROY_TEXTURE",
-    "CREATE_FBO",
-    "DESTROY_FBO",
-    "CHANGE_RENDERER_TARGET",
-    "RESET_RENDERER_TARGET",
-    "CLEAR_RENDERER_TARGET",
-    "UPDATE_RENDERER_TARGET",
-    "CHANGE_TEXTURE_BLENDMODE",
-    "CHANGE_TEXTURE_OPACITY",
-    "CREATE_TTF_TEXT",
-    "RELOAD_TTF_TEXT",
-    "DESTROY_TTF_TEXT",
-    "ENABLE_DISABLE_MULTITHREAD_TEXTURE_LOADING",
-    "TAKE_SCREENSHOT",
-    "EXIT_RENDERING_LOOP",
+// indexed by RendererCmd value
+const Renderer::RendererCmdHandler
+Renderer::CMD_HANDLERS[RENDERER_CMDS_COUNT] {
+  &Renderer::clearScreenExecution_RT,                   // CLEAR_SCREEN
+  &Renderer::finishFrameExecution_RT,                   // FINISH_FRAME
+  &Renderer::changeClearColor_RT,                       // CHANGE_CLEAR_COLOR
+  &Renderer::loadTextureSingle_RT,                      // LOAD_TEXTURE_SINGLE
+  &Renderer::loadTextureMultiple_RT,                    // LOAD_TEXTURE_MULTIPLE
+  &Renderer::destroyTexture_RT,                         // DESTROY_TEXTURE
+  &Renderer::createFBO_RT,                              // CREATE_FBO
+  &Renderer::destroyFBO_RT,                             // DESTROY_FBO
+  &Renderer::changeRendererTarget_RT,                   // CHANGE_RENDERER_TARGET
+  &Renderer::resetRendererTarget_RT,                    // RESET_RENDERER_TARGET
+  &Renderer::clearRendererTarget_RT,                    // CLEAR_RENDERER_TARGET
+  &Renderer::updateRendererTarget_RT,                   // UPDATE_RENDERER_TARGET
+  &Renderer::updateRendererTargetPacked_RT,   // UPDATE_RENDERER_TARGET_PACKED
+  &Renderer::changeTextureBlending_RT,        // CHANGE_TEXTURE_BLENDMODE
+  &Renderer::changeTextureOpacity_RT,         // CHANGE_TEXTURE_OPACITY
+  &Renderer::createTTFText_RT,                // CREATE_TTF_TEXT
+  &Renderer::reloadTTFText_RT,                // RELOAD_TTF_TEXT
+  &Renderer::destroyTTFText_RT,               // DESTROY_TTF_TEXT
+  &Renderer::enableDisableMultithreadTextureLoading_RT,
+                                  // ENABLE_DISABLE_MULTITHREAD_TEXTURE_LOADING
+  &Renderer::takeScreenshot_RT,               // TAKE_SCREENSHOT
+  nullptr                                     // EXIT_RENDERING_LOOP
 };
-}
-#endif /* LOCAL_DEBUG */
 
 Renderer::Renderer()
     : _window(nullptr), _sdlRenderer(nullptr), _containers(nullptr),
-      _updateStateIdx(0), _renderStateIdx(1), _isRendererBusy(false),
-      _isShutdowned(false), _isMultithreadTextureLoadingEnabled(false) {
+      _updateStateIdx(0), _renderStateIdx(1) {
 }
 
 ErrorCode Renderer::init(const RendererConfig &cfg) {
   _window = cfg.window;
   _executionPolicy = valiteRendererExecutionPolicy(cfg.executionPolicy);
 
-  for (int32_t i = 0; i < SUPPORTED_BACK_BUFFERS; ++i) {
+  _presentMode = cfg.presentMode;
+
+#if ENABLE_RENDERER_PROFILING
+  _profiler = std::make_unique<RendererProfiler>();
+#endif /* ENABLE_RENDERER_PROFILING */
+
+  uint32_t pipelineDepth = MIN_RENDERER_PIPELINE_DEPTH;
+  if (RendererPolicy::MULTI_THREADED == _executionPolicy) {
+    if ((MIN_RENDERER_PIPELINE_DEPTH > cfg.pipelineDepth) ||
+        (MAX_RENDERER_PIPELINE_DEPTH < cfg.pipelineDepth)) {
+      LOGERR("Error, received unsupported pipelineDepth: %u. Supported "
+             "range: [%u - %u]", cfg.pipelineDepth,
+             MIN_RENDERER_PIPELINE_DEPTH, MAX_RENDERER_PIPELINE_DEPTH);
+      return ErrorCode::FAILURE;
+    }
+    pipelineDepth = cfg.pipelineDepth;
+
+    if ((FramePresentMode::MAILBOX == _presentMode) &&
+        (MIN_RENDERER_PIPELINE_DEPTH == pipelineDepth)) {
+      LOGERR("Warning, FramePresentMode::MAILBOX with pipelineDepth: %u will "
+           "behave as FramePresentMode::FIFO. Frames could be replaced only "
+           "with pipelineDepth >= %u", pipelineDepth,
+           MIN_RENDERER_PIPELINE_DEPTH + 1);
+    }
+  }
+
+  for (uint32_t i = 0; i < pipelineDepth; ++i) {
     if (ErrorCode::SUCCESS != _rendererState[i].init(cfg)) {
-      LOGERR("_rendererState[%d].init() failed", i);
+      LOGERR("_rendererState[%u].init() failed", i);
       return ErrorCode::FAILURE;
     }
   }
 
+  if (ErrorCode::SUCCESS !=
+      _frameHandoff.init(cfg.frameHandoffPolicy, pipelineDepth)) {
+    LOGERR("_frameHandoff.init() failed");
+    return ErrorCode::FAILURE;
+  }
+  _updateStateIdx = static_cast<int32_t>(_frameHandoff.getUpdateSlot_UT());
+
+  _drawRecordersCount = cfg.drawRecordersCount;
+  if (0 != _drawRecordersCount) {
+    _drawRecorders = std::make_unique<DrawRecorder[]>(_drawRecordersCount);
+    for (uint32_t i = 0; i < _drawRecordersCount; ++i) {
+      _drawRecorders[i].init(cfg.maxRuntimeWidgets / _drawRecordersCount);
+    }
+    _drawRecordersMergeOrder.reserve(_drawRecordersCount);
+  }
+
   /** Set texture filtering to linear
    *                     (used for image scaling /pixel interpolation/ )
    * */
@@ -102,6 +144,82 @@ ErrorCode Renderer::init(const RendererConfig &cfg) {
 
 #endif /* DISABLE_DOUBLE_BUFFERING_SWAP_INTERVAL */
 
+  _drawBackend = cfg.drawBackend;
+  if (DrawBackend::BATCHED_GEOMETRY == _drawBackend) {
+    if (ErrorCode::SUCCESS !=
+        _drawBatcher.init(_sdlRenderer, cfg.maxRuntimeWidgets)) {
+      LOGERR("Warning, _drawBatcher.init() failed. Falling back to "
+             "DrawBackend::RENDER_COPY");
+      _drawBackend = DrawBackend::RENDER_COPY;
+    }
+  } else if (DrawBackend::TILED_SOFTWARE == _drawBackend) {
+    if (!isRendererFlagEnabled(cfg.flagsMask,
+                               RendererFlag::SOFTARE_RENDERER)) {
+      LOGERR("Warning, DrawBackend::TILED_SOFTWARE requires "
+             "RendererFlag::SOFTARE_RENDERER. Falling back to "
+             "DrawBackend::RENDER_COPY");
+      _drawBackend = DrawBackend::RENDER_COPY;
+    } else if (ErrorCode::SUCCESS != _tiledRasterizer.init(
+                   cfg.tiledRasterThreads, cfg.tiledRasterTileSize)) {
+      LOGERR("Warning, _tiledRasterizer.init() failed. Falling back to "
+             "DrawBackend::RENDER_COPY");
+      _drawBackend = DrawBackend::RENDER_COPY;
+    } else {
+      _softwareTextures.init(_sdlRenderer);
+    }
+  }
+
+  _isViewportCullingEnabled = cfg.enableViewportCulling;
+  if (_isViewportCullingEnabled) {
+    if (ErrorCode::SUCCESS != _viewportCuller.init(cfg.maxRuntimeWidgets)) {
+      LOGERR("_viewportCuller.init() failed");
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  _isDrawReorderingEnabled = cfg.enableDrawReordering;
+  if (_isDrawReorderingEnabled) {
+    if (ErrorCode::SUCCESS != _drawReorderer.init(cfg.maxRuntimeWidgets)) {
+      LOGERR("_drawReorderer.init() failed");
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  _isFrameSkippingEnabled = cfg.enableUnchangedFrameSkipping;
+  _forcedPresentInterval = cfg.forcedPresentInterval;
+
+  _isStaticLayerCachingEnabled = cfg.enableStaticLayerCaching;
+  if (_isStaticLayerCachingEnabled) {
+    if (ErrorCode::SUCCESS != _staticLayerCache.init(cfg.maxRuntimeWidgets,
+            cfg.staticLayerStableFrames, cfg.staticLayerMinWidgets)) {
+      LOGERR("_staticLayerCache.init() failed");
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  if (ErrorCode::SUCCESS != _screenshotEncoder.init(
+          cfg.screenshotEncoderThreads, cfg.maxPendingScreenshots)) {
+    LOGERR("_screenshotEncoder.init() failed");
+    return ErrorCode::FAILURE;
+  }
+
+  if (cfg.enableSharedFrameExport) {
+    int32_t outputWidth = 0;
+    int32_t outputHeight = 0;
+    if (EXIT_SUCCESS != SDL_GetRendererOutputSize(_sdlRenderer, &outputWidth,
+                                                  &outputHeight)) {
+      LOGERR("SDL_GetRendererOutputSize() failed: %s", SDL_GetError());
+      return ErrorCode::FAILURE;
+    }
+
+    if (ErrorCode::SUCCESS != _sharedFrameWriter.open(
+            cfg.sharedFrameExportName, cfg.sharedFrameExportSlots,
+            outputWidth, outputHeight)) {
+      LOGERR("_sharedFrameWriter.open() failed");
+      return ErrorCode::FAILURE;
+    }
+  }
+
   Texture::setRenderer(_sdlRenderer);
   LoadingScreen::setRenderer(_sdlRenderer);
 
@@ -115,6 +233,18 @@ ErrorCode Renderer::init(const RendererConfig &cfg) {
 }
 
 void Renderer::deinit() {
+  // write the already read back screenshots
+  _screenshotEncoder.deinit();
+
+  _sharedFrameWriter.close();
+
+  // the layer FBOs are owned by the SDL_Renderer
+  _staticLayerCache.deinit();
+
+  _tiledRasterizer.deinit();
+  _softwareTextures.clear();
+  Texture::freeTexture(_tiledScreenTexture);
+
   if (_sdlRenderer)  // sanity check
   {
     SDL_DestroyRenderer(_sdlRenderer);
@@ -127,94 +257,168 @@ void Renderer::setSDLContainers(SDLContainers *containers) {
 }
 
 void Renderer::clearScreen_UT() {
-  addRendererCmd_UT(RendererCmd::CLEAR_SCREEN);
+  addRendererCmd_UT(ClearScreenPayload { });
 }
 
 void Renderer::finishFrame_UT(const bool overrideRendererLockCheck) {
-  addRendererCmd_UT(RendererCmd::FINISH_FRAME,
-      reinterpret_cast<const uint8_t*>(&overrideRendererLockCheck),
-      sizeof (overrideRendererLockCheck));
+  if (0 != _drawRecordersCount) {
+    mergeDrawRecorders_UT();
+  }
+
+  if (_screenshotBurst.isActive) {
+    updateScreenshotBurst_UT();
+  }
+
+  addRendererCmd_UT(FinishFramePayload { overrideRendererLockCheck });
 
   swapBackBuffers_UT();
 }
 
 void Renderer::addDrawCmd_UT(const DrawParams &drawParams) const {
-  const int32_t idx = _updateStateIdx;
-
-#ifndef NDEBUG
-  if (_rendererState[idx].currWidgetCounter >=
-      _rendererState[idx].maxRuntimeWidgets) {
-    LOGERR("Critical Problem: maxRunTimeWidgets value: %d is reached! "
-           "Increase it's value from the configuration! or reduce the number of"
-           " active widgets. Widgets will not be drawn in order to save the "
-           "system from crashing", _rendererState[idx].maxRuntimeWidgets);
-    return;
+  RendererState &state = _rendererState[_updateStateIdx];
+
+  // the frame is bigger than all of the previous frames
+  if (state.currWidgetCounter >= state.maxRuntimeWidgets) {
+    LOGERR("Warning, maxRuntimeWidgets value: %u is reached! Growing the "
+           "widgets storage in the middle of the frame. Consider increasing "
+           "it's value from the configuration", state.maxRuntimeWidgets);
+    state.growWidgets(std::max(1u, 2 * state.maxRuntimeWidgets));
+    ++_bufferStats.midFrameGrowths;
   }
-#endif //!NDEBUG
 
-  _rendererState[idx].widgets[_rendererState[idx].currWidgetCounter] =
-      drawParams;
+  state.widgets.setDrawParams(state.currWidgetCounter, drawParams);
 
   // increment the total widget count for this frame
-  ++_rendererState[idx].currWidgetCounter;
+  ++state.currWidgetCounter;
+}
+
+void Renderer::addDrawCmds_UT(
+    const std::span<const DrawParams> drawParams) const {
+  RendererState &state = _rendererState[_updateStateIdx];
+  const uint32_t size = static_cast<uint32_t>(drawParams.size());
+  const uint32_t requiredWidgets = state.currWidgetCounter + size;
+
+  // the frame is bigger than all of the previous frames
+  if (requiredWidgets > state.maxRuntimeWidgets) {
+    LOGERR("Warning, maxRuntimeWidgets value: %u is reached! Growing the "
+           "widgets storage in the middle of the frame. Consider increasing "
+           "it's value from the configuration", state.maxRuntimeWidgets);
+    state.growWidgets(std::max(requiredWidgets, 2 * state.maxRuntimeWidgets));
+    ++_bufferStats.midFrameGrowths;
+  }
+
+  for (uint32_t i = 0; i < size; ++i) {
+    state.widgets.setDrawParams(state.currWidgetCounter + i, drawParams[i]);
+  }
+
+  state.currWidgetCounter = requiredWidgets;
+}
+
+DrawRecorder *Renderer::getDrawRecorder(const uint32_t recorderIdx) {
+  if (recorderIdx >= _drawRecordersCount) {
+    LOGERR("Error, invalid recorderIdx: %u. Configured drawRecordersCount: "
+           "%u", recorderIdx, _drawRecordersCount);
+    return nullptr;
+  }
+
+  return &_drawRecorders[recorderIdx];
+}
+
+void Renderer::mergeDrawRecorders_UT() {
+  _drawRecordersMergeOrder.clear();
+  for (uint32_t i = 0; i < _drawRecordersCount; ++i) {
+    if (!_drawRecorders[i].empty()) {
+      _drawRecordersMergeOrder.push_back(i);
+    }
+  }
+
+  // the stable sort keeps the recorder index order for equal keys,
+  // so the frame does not depend on the producer threads timing
+  std::stable_sort(_drawRecordersMergeOrder.begin(),
+      _drawRecordersMergeOrder.end(),
+      [this](const uint32_t lhs, const uint32_t rhs) {
+        return _drawRecorders[lhs].getSortKey() <
+               _drawRecorders[rhs].getSortKey();
+      });
+
+  for (const uint32_t recorderIdx : _drawRecordersMergeOrder) {
+    DrawRecorder &recorder = _drawRecorders[recorderIdx];
+    addDrawCmds_UT(recorder.getDrawCmds());
+    recorder.clear();
+  }
 }
 
 void Renderer::addRendererCmd_UT(const RendererCmd rendererCmd,
                                  const uint8_t *data, const uint64_t bytes) {
-  const int32_t idx = _updateStateIdx;
-
-#ifndef NDEBUG
-  if (_rendererState[idx].currRendererCmdsCounter >=
-      _rendererState[idx].maxRuntimeRendererCmds) {
-    LOGERR("Critical Problem: maxRunTimeRendererCommands value: %d is reached! "
-           "Increase it's value from the configuration! or reduce the number of"
-           " renderer calls. Renderer command: %hhu will not be execution in "
-           "order to save the system from crashing",
-           _rendererState[idx].maxRuntimeRendererCmds,
-           getEnumValue(rendererCmd));
-    return;
+  RendererState &state = _rendererState[_updateStateIdx];
+
+  // the frame is bigger than all of the previous frames
+  if (state.currRendererCmdsCounter >= state.maxRuntimeRendererCmds) {
+    LOGERR("Warning, maxRuntimeRendererCommands value: %u is reached! "
+           "Growing the renderer commands storage in the middle of the frame."
+           " Consider increasing it's value from the configuration",
+           state.maxRuntimeRendererCmds);
+    state.growRendererCmds(std::max(1u, 2 * state.maxRuntimeRendererCmds));
+    ++_bufferStats.midFrameGrowths;
   }
-#endif //NDEBUG
 
-  _rendererState[idx].rendererCmd[_rendererState[idx].currRendererCmdsCounter] =
-      rendererCmd;
-  ++_rendererState[idx].currRendererCmdsCounter;
+  state.rendererCmd[state.currRendererCmdsCounter] = rendererCmd;
+  ++state.currRendererCmdsCounter;
 
-  if (bytes) {
-    if (bytes != _rendererState[idx].renderData.write(data, bytes)) {
-      LOGERR(
-          "Warning, Circular buffer overflow for %" PRIu64" bytes"
-          "(write data size is bigger than buffer capacity)!",
-          bytes);
-    }
+  if ((RendererCmd::CLEAR_SCREEN != rendererCmd) &&
+      (RendererCmd::FINISH_FRAME != rendererCmd)) {
+    state.hasPersistentCmds = true;
   }
 
-#if LOCAL_DEBUG
-  LOGC("%s command pushed with %zu bytes of data, commands counter: %u",
-       RENDERER_CMD_NAMES[getEnumValue(rendererCmd)], bytes,
-       _rendererState[idx].currRendererCmdsCounter);
-#endif /* LOCAL_DEBUG */
+  if (bytes) {
+    addRendererData_UT(data, bytes);
+  }
 }
 
 void Renderer::addRendererData_UT(const uint8_t *data, const uint64_t bytes) {
-  if (bytes != _rendererState[_updateStateIdx].renderData.write(data, bytes)) {
-    LOGERR("Warning, Circular buffer overflow for %" PRIu64" bytes"
-          "(write data size is bigger than buffer capacity)!", bytes);
+  RenderDataBuffer &renderData = _rendererState[_updateStateIdx].renderData;
+
+  const uint64_t oldCapacity = renderData.capacity();
+  renderData.write(data, bytes);
+  if (oldCapacity != renderData.capacity()) {
+    // the stored data is not moved, only a new chunk is added
+    ++_bufferStats.midFrameGrowths;
+  }
+
+  _frameCapture.recordData(data, bytes);
+}
+
+void Renderer::updateRendererTarget_UT(const DrawParams drawParamsArr[],
+                                       const uint32_t size) {
+  const uint64_t maxEncodedBytes =
+      static_cast<uint64_t>(size) * DrawParamsCodec::MAX_ENCODED_SIZE;
+  if (maxEncodedBytes > _updatePackedWidgets.size()) {
+    _updatePackedWidgets.resize(maxEncodedBytes);
   }
 
-#if LOCAL_DEBUG
-  LOGC("%zu bytes of data is being pushed, value: %u", bytes,
-       *(reinterpret_cast<const uint32_t *>(data)));
-#endif /* LOCAL_DEBUG */
+  const uint64_t encodedBytes = DrawParamsCodec::encodeArray(drawParamsArr,
+      size, _updatePackedWidgets.data());
+
+  addRendererCmd_UT(UpdateRendererTargetPackedPayload { size, encodedBytes },
+                    _updatePackedWidgets.data(), encodedBytes);
 }
 
 void Renderer::shutdownRenderer_UT() {
-  addRendererCmd_UT(RendererCmd::EXIT_RENDERING_LOOP);
+  // the exit command is not part of the captured frames
+  stopFrameCapture_UT();
+
+  addRendererCmd_UT(ExitRenderingLoopPayload { });
 
   swapBackBuffers_UT();
 }
 
 void Renderer::swapBackBuffers_UT() {
+  if (_frameCapture.isOpen()) {
+    _frameCapture.finishFrame(_rendererState[_updateStateIdx]);
+  }
+
+  updateBufferStats_UT();
+
   if (RendererPolicy::SINGLE_THREADED == _executionPolicy) {
     // acquire isLocked from the update index, before the swap, because
     // after the swap we should operate on the real isLocked variable
@@ -224,55 +428,67 @@ void Renderer::swapBackBuffers_UT() {
     // swap containers
     std::swap(_updateStateIdx, _renderStateIdx);
 
-    // prepare the renderer thread 'done' flag
-    _isRendererBusy = true;
-
     //execute the stored commands
     executeRenderCommandsInternal();
+
+    reserveBuffers_UT();
     return;
   }
 
-  // acquire lock for render mutex
-  std::unique_lock<std::mutex> renderLock(_renderMutex);
+  const bool isFrameReplaced = (FramePresentMode::MAILBOX == _presentMode) &&
+                               tryReplacePendingFrame_UT();
 
-  if (_isShutdowned) {
-    return;
+  // wait for the renderer thread to release the next renderer state
+  if (!isFrameReplaced && !_frameHandoff.waitForFreeSlot_UT()) {
+    return; // renderer has already been shutdowned
   }
 
-  /** Condition variables can be subject to spurious wake-ups,
-   *  so it is important to check the actual condition
-   *  being waited for when the call to wait returns
-   * */
-  while (_isRendererBusy) {
-#if LOCAL_DEBUG
-    LOGC("sleeping on _renderCondVar");
-#endif /* LOCAL_DEBUG */
-    _renderCondVar.wait(renderLock);
+  // acquire isLocked from the update index, before the handoff, because
+  // after the handoff we should operate on the real isLocked variable
+  const bool isLocked = _rendererState[_updateStateIdx].isLocked;
+
+  // hand the populated renderer state to the renderer thread
+  _frameHandoff.publishFrame_UT();
+
+  _updateStateIdx = static_cast<int32_t>(_frameHandoff.getUpdateSlot_UT());
+  RendererState &updateState = _rendererState[_updateStateIdx];
+  updateState.isLocked = isLocked;
+  updateState.hasPersistentCmds = false;
+  if (isFrameReplaced) {
+    // the replaced frame was never executed
+    updateState.discardFrame();
+    ++_pipelineStats.replacedFrames;
   }
+  reserveBuffers_UT();
 
-#if LOCAL_DEBUG
-  LOGC("_renderCondVar informed.");
-#endif /* LOCAL_DEBUG */
-
-  // acquire lock for update mutex
-  std::unique_lock<std::mutex> updateLock(_updateMutex);
-
-  // acquire isLocked from the update index, before the swap, because
-  // after the swap we should operate on the real isLocked variable
-  _rendererState[_renderStateIdx].isLocked =
-      _rendererState[_updateStateIdx].isLocked;
+  ++_pipelineStats.publishedFrames;
+  _pipelineStats.framesInFlight = _frameHandoff.getFramesInFlight();
+  _pipelineStats.maxFramesInFlight = std::max(
+      _pipelineStats.maxFramesInFlight, _pipelineStats.framesInFlight);
+}
 
-  // swap containers
-  std::swap(_updateStateIdx, _renderStateIdx);
+void Renderer::updateBufferStats_UT() {
+  const RendererState &state = _rendererState[_updateStateIdx];
 
-  // prepare the renderer thread 'done' flag
-  _isRendererBusy = true;
+  _bufferStats.widgetsHighWater =
+      std::max(_bufferStats.widgetsHighWater, state.currWidgetCounter);
+  _bufferStats.rendererCmdsHighWater = std::max(
+      _bufferStats.rendererCmdsHighWater, state.currRendererCmdsCounter);
+  _bufferStats.renderDataHighWater =
+      std::max(_bufferStats.renderDataHighWater, state.renderData.size());
 
-  // manually unlock the mutex before notifying the renderer thread
-  updateLock.unlock();
+  _bufferStats.widgetsCapacity = state.maxRuntimeWidgets;
+  _bufferStats.rendererCmdsCapacity = state.maxRuntimeRendererCmds;
+  _bufferStats.renderDataCapacity = state.renderData.capacity();
+}
 
-  // wake the renderer thread that is sleeping on the condition variable
-  _updateCondVar.notify_one();
+void Renderer::reserveBuffers_UT() {
+  // grow the fresh renderer state up front, so the frames with already
+  // seen sizes never grow their buffers in the middle of the frame
+  RendererState &state = _rendererState[_updateStateIdx];
+  state.growWidgets(_bufferStats.widgetsHighWater);
+  state.growRendererCmds(_bufferStats.rendererCmdsHighWater);
+  state.renderData.reserve(_bufferStats.renderDataHighWater);
 }
 
 ErrorCode Renderer::unlockRenderer_UT() {
@@ -290,7 +506,7 @@ ErrorCode Renderer::unlockRenderer_UT() {
 ErrorCode Renderer::lockRenderer_UT() {
   if (!_rendererState[_updateStateIdx].isLocked) {
     _rendererState[_updateStateIdx].isLocked = true;
-    addRendererCmd_UT(RendererCmd::RESET_RENDERER_TARGET);
+    addRendererCmd_UT(ResetRendererTargetPayload { });
   } else {
     LOGERR("Error, trying to lock the main renderer, when it's already locked");
     return ErrorCode::FAILURE;
@@ -299,40 +515,115 @@ ErrorCode Renderer::lockRenderer_UT() {
   return ErrorCode::SUCCESS;
 }
 
+ErrorCode Renderer::startFrameCapture_UT(const std::string &file,
+                                         const uint32_t framesCount) {
+  int32_t windowWidth = 0;
+  int32_t windowHeight = 0;
+  if (nullptr != _window) {
+    SDL_GetWindowSize(_window, &windowWidth, &windowHeight);
+  }
+
+  if (ErrorCode::SUCCESS !=
+      _frameCapture.open(file, framesCount, windowWidth, windowHeight)) {
+    LOGERR("Error, _frameCapture.open() failed");
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void Renderer::stopFrameCapture_UT() {
+  _frameCapture.close();
+}
+
+void Renderer::replayFrame_UT(const CapturedFrame &frame) {
+  for (const RendererCmd rendererCmd : frame.rendererCmds) {
+    addRendererCmd_UT(rendererCmd);
+  }
+
+  // the renderer thread consumes the data in the order it was written
+  addRendererData_UT(frame.renderData.data(), frame.renderData.size());
+
+  for (const DrawParams &drawParams : frame.widgets) {
+    addDrawCmd_UT(drawParams);
+  }
+
+  RendererState &state = _rendererState[_updateStateIdx];
+  state.globalOffsetX = frame.globalOffsetX;
+  state.globalOffsetY = frame.globalOffsetY;
+  state.isLocked = frame.isLocked;
+  state.isReplayedFrame = true;
+
+  swapBackBuffers_UT();
+}
+
 void Renderer::takeScreenshot_UT(const char *file,
                                  const ScreenshotContainer container,
-                                 const int32_t quality) {
+                                 const int32_t quality,
+                                 const ScreenshotCompletionCb &completionCb) {
   const uint64_t fileStrLen = std::strlen(file);
-  const uint64_t dataSize = sizeof (fileStrLen) + fileStrLen + sizeof (container)
-               + sizeof (quality);
+  const uint64_t screenshotId =
+      _screenshotEncoder.registerScreenshot(completionCb);
+
+  addRendererCmd_UT(
+      TakeScreenshotPayload { container, quality, fileStrLen, screenshotId },
+      reinterpret_cast<const uint8_t*>(file), fileStrLen);
+}
 
-  uint8_t* data = new uint8_t[dataSize];
-  if (nullptr == data) {
-    LOGERR("Error, bad alloc for 'data'");
+void Renderer::startScreenshotBurst_UT(const char *filePrefix,
+    const ScreenshotContainer container, const int32_t quality,
+    const uint32_t frameInterval, const uint32_t framesCount,
+    const ScreenshotCompletionCb &completionCb) {
+  if (0 == frameInterval) {
+    LOGERR("Error, frameInterval can not be 0");
     return;
   }
-  
-  uint64_t populatedBytes = 0;
 
-  memcpy(data + populatedBytes, &container, sizeof (container));
-  populatedBytes += sizeof (container);
-
-  memcpy(data + populatedBytes, &quality, sizeof (quality));
-  populatedBytes += sizeof (quality);
+  _screenshotBurst.filePrefix = filePrefix;
+  _screenshotBurst.completionCb = completionCb;
+  _screenshotBurst.container = container;
+  _screenshotBurst.quality = quality;
+  _screenshotBurst.frameInterval = frameInterval;
+  _screenshotBurst.framesLeft = framesCount;
+  _screenshotBurst.capturedCount = 0;
+
+  // the first screenshot is taken from the current frame
+  _screenshotBurst.framesSinceCapture = frameInterval - 1;
+  _screenshotBurst.isActive = true;
+}
 
-  memcpy(data + populatedBytes, &fileStrLen, sizeof (fileStrLen));
-  populatedBytes += sizeof (fileStrLen);
+void Renderer::stopScreenshotBurst_UT() {
+  _screenshotBurst.isActive = false;
+  _screenshotBurst.completionCb = nullptr;
+}
 
-  memcpy(data + populatedBytes, file, fileStrLen);
-  populatedBytes += fileStrLen;
+uint64_t Renderer::getDroppedScreenshotsCount_UT() const {
+  return _screenshotEncoder.getDroppedScreenshotsCount();
+}
 
-  addRendererCmd_UT(RendererCmd::TAKE_SCREENSHOT, data, populatedBytes);
-  delete[] data;
+void Renderer::updateScreenshotBurst_UT() {
+  ++_screenshotBurst.framesSinceCapture;
+  if (_screenshotBurst.framesSinceCapture < _screenshotBurst.frameInterval) {
+    return;
+  }
+  _screenshotBurst.framesSinceCapture = 0;
+
+  const char *extension =
+      (ScreenshotContainer::PNG == _screenshotBurst.container) ? ".png"
+                                                               : ".jpg";
+  const std::string file = _screenshotBurst.filePrefix +
+      std::to_string(_screenshotBurst.capturedCount) + extension;
+  takeScreenshot_UT(file.c_str(), _screenshotBurst.container,
+                    _screenshotBurst.quality, _screenshotBurst.completionCb);
+  ++_screenshotBurst.capturedCount;
+
+  if (_screenshotBurst.capturedCount == _screenshotBurst.framesLeft) {
+    stopScreenshotBurst_UT();
+  }
 }
 
 void Renderer::setRendererClearColor_UT(const Color &clearColor) {
-  addRendererCmd_UT(RendererCmd::CHANGE_CLEAR_COLOR,
-      reinterpret_cast<const uint8_t*>(&clearColor), sizeof (clearColor));
+  addRendererCmd_UT(ChangeClearColorPayload { clearColor });
 }
 
 void Renderer::resetAbsoluteGlobalMovement_UT() {
@@ -353,47 +644,16 @@ void Renderer::moveGlobalY_UT(const int32_t y) {
 }
 
 void Renderer::executeRenderCommands_RT() {
-  /** IMPORTANT NOTE: use directly the variable _renderStateIdx
-   *                 (don't cache it), because it will constantly be changed
-   *                 in the course of the program
-   **/
-
-  // acquire lock on the update update mutex
-  std::unique_lock<std::mutex> updateLock(_updateMutex);
-
-  // construct the unique_lock object without locking the _renderMutex
-  std::unique_lock<std::mutex> renderLock(_renderMutex, std::defer_lock);
-
   while (true) {
-    /** Condition variables can be subject to spurious wake-ups,
-     *  so it is important to check the actual condition
-     *  being waited for when the call to wait returns
-     * */
-    while (0 == _rendererState[_renderStateIdx].currRendererCmdsCounter) {
-#if LOCAL_DEBUG
-      LOGY("Waiting on _updateCondVar");
-#endif /* LOCAL_DEBUG */
-
-      _updateCondVar.wait(updateLock);
-    }
-
-#if LOCAL_DEBUG
-    LOGY("_updateCondVar informed");
-#endif /* LOCAL_DEBUG */
-
-    // lock render mutex -> this prevents the update thread for pushing
-    // several updates before this draw is finished
-    renderLock.lock();
+    _renderStateIdx = static_cast<int32_t>(_frameHandoff.waitForFrame_RT());
 
     const bool shouldExit = executeRenderCommandsInternal();
     if (shouldExit) {
       return;
     }
 
-    renderLock.unlock();
-
-    // wake the update thread that is sleeping on the condition variable
-    _renderCondVar.notify_one();
+    // let the update thread reuse the renderer state
+    _frameHandoff.releaseFrame_RT();
   }
 }
 
@@ -402,30 +662,18 @@ RendererPolicy Renderer::getRendererPolicy() const {
 }
 
 void Renderer::clearScreenExecution_RT() {
-#if LOCAL_DEBUG
-  LOGY("Executing clearScreenExecution_RT() (with 0 bytes of data)");
-#endif /* LOCAL_DEBUG */
-
-  // clear screen
-  if (EXIT_SUCCESS != SDL_RenderClear(_sdlRenderer)) {
-    LOGERR("Error in, SDL_RenderClear(), SDL Error: %s", SDL_GetError());
-    return;
+  // the draw color could be left changed by a FBO clear
+  if (ErrorCode::SUCCESS != Texture::clearCurrentRendererTarget(_clearColor)) {
+    LOGERR("Error in Texture::clearCurrentRendererTarget()");
   }
 }
 
 void Renderer::finishFrameExecution_RT() {
   const int32_t idx = _renderStateIdx;
 
-  bool overrideRendererLockCheck = false;
-  _rendererState[idx].renderData >> overrideRendererLockCheck;
+  const auto payload = readRendererCmdPayload_RT<FinishFramePayload>();
 
-#if LOCAL_DEBUG
-  LOGY("Executing finishFrameExecution_RT(), overrideRendererLockCheck: %d "
-       "(with %zu bytes of data)",
-       overrideRendererLockCheck, sizeof(overrideRendererLockCheck));
-#endif /* LOCAL_DEBUG */
-
-  if (!overrideRendererLockCheck && !_rendererState[idx].isLocked) {
+  if (!payload.overrideRendererLockCheck && !_rendererState[idx].isLocked) {
     LOGERR("WARNING, WARNING, WARNING, Renderer is left unlocked! Consider "
            "locking back the renderer in the same draw cycle after you are "
            "done with your work.");
@@ -443,99 +691,143 @@ void Renderer::finishFrameExecution_RT() {
   // store in a local variable for better cache performance
   const uint32_t USED_SIZE = _rendererState[idx].currWidgetCounter;
 
-  // apply global offset (if they are turned on)
-  applyGlobalOffsets_RT(USED_SIZE);
+  if (isFrameUnchanged_RT(USED_SIZE)) {
+    // the screen already shows the same image
+    ++_skippedFrames;
+  } else {
+    // apply global offset (if they are turned on)
+    applyGlobalOffsets_RT(USED_SIZE);
 
-  // do the actual drawing of all stored images for THIS FRAME
-  drawWidgetsToBackBuffer_RT(_rendererState[idx].widgets.data(), USED_SIZE);
+    FrameWidgets &widgets = _rendererState[idx].widgets;
+    uint32_t drawnWidgetsCount = USED_SIZE;
+    if (_isViewportCullingEnabled) {
+      drawnWidgetsCount = cullWidgets_RT(widgets, USED_SIZE);
+    }
 
-  //------------- UPDATE SCREEN----------------
-  SDL_RenderPresent(_sdlRenderer);
+    LayerSorter::sort(widgets, drawnWidgetsCount,
+                      _rendererState[idx].frameArena);
+
+    resolveWidgetTextures_RT(widgets, drawnWidgetsCount);
+
+    // the layers are drawn only on the default renderer target
+    if (_isStaticLayerCachingEnabled && _rendererState[idx].isLocked) {
+      drawnWidgetsCount = applyStaticLayers_RT(widgets, drawnWidgetsCount);
+    }
+
+    if (_isDrawReorderingEnabled) {
+      reorderWidgets_RT(drawnWidgetsCount);
+    }
+
+    // the tiled rasterisation replaces the whole default renderer target
+    const bool isRasterized =
+        (DrawBackend::TILED_SOFTWARE == _drawBackend) &&
+        _rendererState[idx].isLocked &&
+        rasterizeWidgetsToBackBuffer_RT(widgets, drawnWidgetsCount);
+
+    // do the actual drawing of all stored images for THIS FRAME
+    if (!isRasterized) {
+      drawWidgetsToBackBuffer_RT(widgets, drawnWidgetsCount);
+    }
+
+    // the frame is complete, but still not presented
+    if (!_screenshotRequests.empty()) {
+      captureScreenshots_RT();
+    }
+
+    // the back buffer content is undefined after the present
+    if (_sharedFrameWriter.isOpen() && _rendererState[idx].isLocked) {
+      exportSharedFrame_RT();
+    }
+
+    //------------- UPDATE SCREEN----------------
+    SDL_RenderPresent(_sdlRenderer);
+  }
 
   // copy the total widget counter since we are in the end of a frame
   _rendererState[idx].lastTotalWidgetCounter =
       _rendererState[idx].currWidgetCounter;
 
+  _rendererState[idx].lastDrawStats.culledWidgets = _frameCulledWidgets;
+  _frameCulledWidgets = 0;
+  _rendererState[idx].lastDrawStats.skippedFrames = _skippedFrames;
+  _rendererState[idx].lastDrawStats.staticLayerRenders = _staticLayerRenders;
+  _rendererState[idx].lastDrawStats.avoidedStateChanges =
+      Texture::getAvoidedStateChangesCount();
+  Texture::resetAvoidedStateChangesCount();
+  _rendererState[idx].lastDrawStats.sharedFramesExported =
+      _sharedFrameWriter.getPublishedFramesCount();
+
+  // release the transient allocations of the frame
+  FrameArena &frameArena = _rendererState[idx].frameArena;
+  frameArena.reset();
+  _rendererState[idx].lastDrawStats.arenaHeapAllocations =
+      frameArena.getLastFrameHeapAllocations();
+  _rendererState[idx].lastDrawStats.arenaUsedBytes =
+      frameArena.getLastFrameUsedBytes();
+
   // reset the widget count
   _rendererState[idx].currWidgetCounter = 0;
 }
 
-void Renderer::changeClearColor_RT() {
-  // note: there is no default constructor for color, the Colors::BLACK
-  // is just for initialisation
-  Color clearColor = Colors::BLACK;
+bool Renderer::isFrameUnchanged_RT(const uint32_t widgetsSize) {
+  if (!_isFrameSkippingEnabled) {
+    return false;
+  }
 
-  _rendererState[_renderStateIdx].renderData >> clearColor;
+  const RendererState &state = _rendererState[_renderStateIdx];
+  constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+  const uint64_t offsets =
+      (static_cast<uint64_t>(static_cast<uint32_t>(state.globalOffsetX))
+          << 32) | static_cast<uint32_t>(state.globalOffsetY);
+  const uint64_t frameHash =
+      (state.widgets.computeHash(widgetsSize) ^ offsets) * MULTIPLIER;
+
+  const bool hasStateChanges = _frameHasStateChanges;
+  _frameHasStateChanges = false;
+
+  const bool isPresentForced = (0 != _forcedPresentInterval) &&
+      (_framesSincePresent + 1 >= _forcedPresentInterval);
+  if (!hasStateChanges && !isPresentForced &&
+      (frameHash == _lastPresentedFrameHash)) {
+    ++_framesSincePresent;
+    return true;
+  }
 
-#if LOCAL_DEBUG
-  LOGY("Executing changeClearColor_RT(), clerColor32BitRGBA: %u (with %zu "
-       "bytes of data", clearColor.get32BitRGBA(), sizeof(clearColor));
-#endif /* LOCAL_DEBUG */
+  _lastPresentedFrameHash = frameHash;
+  _framesSincePresent = 0;
+  return false;
+}
 
-  // set renderer drawing color
-  if (EXIT_SUCCESS != SDL_SetRenderDrawColor(_sdlRenderer, clearColor.rgba.r,
-          clearColor.rgba.g, clearColor.rgba.b, clearColor.rgba.a)) {
-    LOGERR("Error in, SDL_SetRenderDrawColor(), SDL Error: %s", SDL_GetError());
-  }
+void Renderer::changeClearColor_RT() {
+  // applied on the next screen clear
+  _clearColor =
+      readRendererCmdPayload_RT<ChangeClearColorPayload>().clearColor;
 }
 
 void Renderer::loadTextureSingle_RT() {
-  uint64_t rsrcId = 0;
-
-  _rendererState[_renderStateIdx].renderData >> rsrcId;
-
-#if LOCAL_DEBUG
-  LOGY("Executing loadTextureSingle_RT(), rsrcId: %zu with (%zu bytes of "
-       "data)",rsrcId, sizeof(rsrcId));
-#endif /* LOCAL_DEBUG */
+  const auto payload = readRendererCmdPayload_RT<LoadTextureSinglePayload>();
+  const uint64_t rsrcId = payload.rsrcId;
 
   SDL_Surface *surface = nullptr;
 
-  if (_isMultithreadTextureLoadingEnabled) {
-    // temporary variables used for _loadedSurfacesThreadQueue::pop operation
-    std::pair<uint64_t, SDL_Surface*> currResSurface(0, nullptr);
-
-    ThreadSafeQueue<std::pair<uint64_t, SDL_Surface*>> *surfaceQueue =
-        _containers->getLoadedSurfacesQueue();
-
-    while (true) {
-      /** Block rendering thread and wait resources to be pushed
-       * into the _loadedSurfacesThreadQueue
-       * */
-      const auto [isShutdowned, hasTimedOut] = surfaceQueue->waitAndPop(
-          currResSurface);
-      if (isShutdowned) {
-        LOG("surfaceQueue shutdowned");
-        return;
-      }
-      if (hasTimedOut) {
-        continue;
-      }
+  SurfaceLoadBatch *surfaceBatch = getSurfaceLoadBatch_RT(payload.surfaceBatch);
+  if (nullptr != surfaceBatch) {
+    std::pair<uint64_t, SDL_Surface*> rsrcSurface(0, nullptr);
 
-      if (rsrcId == currResSurface.first) {
-        surface = currResSurface.second;
-        break; // correct rsrcId found -> stop the search
-      } else {
-        /** The popped rsrcId does not follow the request order of the
-         * resource -> return it back to the surfaceQueue and extract
-         * the next one.
-         *
-         * This can happen due to the multithreading nature of
-         * surfaceQueue. It is not keeping it's elements in the
-         * same order as they were inserted.
-         *
-         * For example a loadTextureSingle_RT() can be requested with
-         * rsrcIds 1 2.
-         *
-         * 2 can be ready at some time and are stored into the
-         * surfaceQueue, but 1 is still not.
-         *
-         * In this method it is required to keep the original order of
-         * requested rsrcIds 1 and 2 so -> 2 is returned back to the
-         * queue until finally 1 arrives.
-         * */
-        surfaceQueue->push(std::move(currResSurface));
-      }
+    /** Block rendering thread and wait for the worker thread to deliver
+     * the surface. Only the surface of this request is delivered
+     * into the batch.
+     * */
+    if (!surfaceBatch->waitAndPop(rsrcSurface)) {
+      LOG("surfaceBatch shutdowned");
+      return;
+    }
+    _containers->releaseSurfaceLoadBatch(surfaceBatch);
+
+    surface = rsrcSurface.second;
+    if (nullptr == surface) {
+      LOGERR("Error, surface loading failed for rsrcId: %" PRIu64, rsrcId);
+      return;
     }
   } else  // single thread approach
   {
@@ -554,6 +846,7 @@ void Renderer::loadTextureSingle_RT() {
   if (ErrorCode::SUCCESS != Texture::loadTextureFromSurface(surface, texture)) {
     LOGERR("Error in Texture::loadTextureFromSurface() for rsrcId: %" PRIu64,
         rsrcId);
+    Texture::freeSurface(surface);
     return;
   }
 
@@ -562,27 +855,24 @@ void Renderer::loadTextureSingle_RT() {
 }
 
 void Renderer::loadTextureMultiple_RT() {
-  uint32_t itemsToPop = 0;
-  int32_t batchId = 0;
-
-  _rendererState[_renderStateIdx].renderData >> itemsToPop >> batchId;
-  std::vector<uint64_t> rsrcIds(itemsToPop);
-
-#if LOCAL_DEBUG
-  LOGY("Executing loadTextureMultiple_RT(), itemsTopPop: %u, batchId: %d "
-       "(with %zu bytes of data)", itemsToPop, batchId,
-      (sizeof(itemsToPop) + sizeof(batchId) + (itemsToPop * sizeof(uint64_t))));
-#endif /* LOCAL_DEBUG */
-
-  for (uint32_t i = 0; i < itemsToPop; ++i) {
-    _rendererState[_renderStateIdx].renderData >> rsrcIds[i];
-#if LOCAL_DEBUG
-    LOGY("Extracting rsrcIds[%u]: %zu", i, rsrcIds[i]);
-#endif /* LOCAL_DEBUG */
+  const auto payload = readRendererCmdPayload_RT<LoadTextureMultiplePayload>();
+  const uint32_t itemsToPop = payload.itemsCount;
+  const int32_t batchId = payload.batchId;
+  SurfaceLoadBatch *surfaceBatch = getSurfaceLoadBatch_RT(payload.surfaceBatch);
+
+  uint64_t *rsrcIds = _rendererState[_renderStateIdx].frameArena.
+      allocateArray<uint64_t>(itemsToPop);
+  if (!readRendererData_RT(reinterpret_cast<uint8_t*>(rsrcIds),
+                           itemsToPop * sizeof(uint64_t))) {
+    // the worker threads still deliver the requested surfaces
+    if (nullptr != surfaceBatch) {
+      discardSurfaceLoadBatch_RT(surfaceBatch, itemsToPop);
+    }
+    return;
   }
 
-  if (_isMultithreadTextureLoadingEnabled) {
-    loadTextureMultipleMulltiThread_RT(rsrcIds, itemsToPop);
+  if (nullptr != surfaceBatch) {
+    loadTextureMultipleMulltiThread_RT(surfaceBatch, itemsToPop);
   } else { // single thread approach
     loadTextureMultipleSingleThread_RT(rsrcIds, itemsToPop);
   }
@@ -591,7 +881,7 @@ void Renderer::loadTextureMultiple_RT() {
 }
 
 void Renderer::loadTextureMultipleSingleThread_RT(
-    const std::vector<uint64_t>& rsrcIds, uint32_t itemsToPop) {
+    const uint64_t *rsrcIds, uint32_t itemsToPop) {
   SDL_Surface *surface = nullptr;
   SDL_Texture *texture = nullptr;
   int32_t currSurfaceWidth = 0;
@@ -632,141 +922,117 @@ void Renderer::loadTextureMultipleSingleThread_RT(
 }
 
 void Renderer::loadTextureMultipleMulltiThread_RT(
-    std::vector<uint64_t>& rsrcIds, uint32_t itemsToPop) {
-  // temporary variables used for _loadedSurfacesThreadQueue::pop operation
-  std::pair<uint64_t, SDL_Surface*> currResSurface(0, nullptr);
-  ThreadSafeQueue<std::pair<uint64_t, SDL_Surface*>> *surfaceQueue =
-      _containers->getLoadedSurfacesQueue();
+    SurfaceLoadBatch *surfaceBatch, uint32_t itemsToPop) {
+  std::pair<uint64_t, SDL_Surface*> rsrcSurface(0, nullptr);
 
   SDL_Texture *texture = nullptr;
   int32_t currSurfaceWidth = 0;
   int32_t currSurfaceHeight = 0;
 
-  // start uploading on the GPU on the rendering thread
+  /** Upload on the GPU in completion order. The worker threads deliver
+   * only the surfaces of this request into the batch, so they are
+   * consumed without searching and without returning foreign ones back.
+   *
+   * Every requested surface must be consumed (even a failed one),
+   * before the batch can be reused by another request.
+   * */
   while (0 != itemsToPop) {
-    /** Block rendering thread and wait resources to be pushed
-     * into the _loadedSurfacesThreadQueue
-     * */
-    const auto [isShutdowned, hasTimedOut] = surfaceQueue->waitAndPop(
-        currResSurface);
-    if (isShutdowned) {
-      LOG("surfaceQueue shutdowned");
+    // Block rendering thread and wait for the next surface of the batch
+    if (!surfaceBatch->waitAndPop(rsrcSurface)) {
+      LOG("surfaceBatch shutdowned");
       return;
     }
-    if (hasTimedOut) {
-      continue;
-    }
-
-    auto it = std::find(rsrcIds.begin(), rsrcIds.end(), currResSurface.first);
-
-    if (rsrcIds.end() == it) {
-      /** The popped rsrcId does not belong to the requested 'patch'
-       * of resources -> return it back to the surfaceQueue and
-       * extract the next one.
-       *
-       * This can happen due to the multithreading nature of
-       * surfaceQueue. It is not keeping it's elements in the
-       * same order as they were inserted.
-       *
-       * For example a loadTextureMultiple_RT() can be requested
-       * with rsrcIds 1 2 3.
-       *
-       * 2 and 3 are ready at some time and are stored into the
-       * surfaceQueue, but 1 is still not.
-       *
-       * In that time another call to loadTextureMultiple_RT() with
-       * different rsrcIds - lets say 4 5.
-       *
-       * 4 and 5 are finished and are stored to the surfaceQueue.
-       * At this moment 1 is ready and is stored last
-       * in the surfaceQueue
-       *
-       * In this method it is required to process rsrcIds 1 2 and 3.
-       * We process 2 and 3, because they are first in the queue and
-       * when we pop 4 and 5 -> they are returned back to queue ...
-       * multiple times, until finally 1 arrives.
-       * */
-      surfaceQueue->push(std::move(currResSurface));
+    --itemsToPop;
 
+    if (nullptr == rsrcSurface.second) {
+      LOGERR("Error, surface loading failed for rsrcId: %" PRIu64,
+             rsrcSurface.first);
       continue;
     }
 
-    // elements successfully found -> remove it
-    rsrcIds.erase(it);
-
-    currSurfaceWidth = currResSurface.second->w;
-    currSurfaceHeight = currResSurface.second->h;
+    currSurfaceWidth = rsrcSurface.second->w;
+    currSurfaceHeight = rsrcSurface.second->h;
 
     if (ErrorCode::SUCCESS != Texture::loadTextureFromSurface(
-            currResSurface.second, texture)) {
+            rsrcSurface.second, texture)) {
       LOGERR(
           "Error in Texture::loadTextureFromSurface() for rsrcId: %" PRIu64,
-          currResSurface.first);
-
-      return;
+          rsrcSurface.first);
+      Texture::freeSurface(rsrcSurface.second);
+      continue;
     }
 
-    _containers->attachRsrcTexture(currResSurface.first, currSurfaceWidth,
+    _containers->attachRsrcTexture(rsrcSurface.first, currSurfaceWidth,
         currSurfaceHeight, texture);
 
     // reset the variable so it can be reused
     texture = nullptr;
+  }
 
-    --itemsToPop;
+  _containers->releaseSurfaceLoadBatch(surfaceBatch);
+}
+
+SurfaceLoadBatch *Renderer::getSurfaceLoadBatch_RT(
+    SurfaceLoadBatch *payloadBatch) const {
+  // the replayed commands hold the batches of the captured session.
+  // Nobody delivers into them - load the surfaces on the renderer thread
+  if (_rendererState[_renderStateIdx].isReplayedFrame) {
+    return nullptr;
   }
+
+  // a non-null batch is already fed by the worker threads and has to be
+  // consumed, regardless of any later strategy change
+  return payloadBatch;
 }
 
-void Renderer::destroyTexture_RT() {
-  uint64_t rsrcId = 0;
+void Renderer::discardSurfaceLoadBatch_RT(SurfaceLoadBatch *surfaceBatch,
+                                          uint32_t itemsToPop) {
+  std::pair<uint64_t, SDL_Surface*> rsrcSurface(0, nullptr);
 
-  _rendererState[_renderStateIdx].renderData >> rsrcId;
+  while (0 != itemsToPop) {
+    if (!surfaceBatch->waitAndPop(rsrcSurface)) {
+      LOG("surfaceBatch shutdowned");
+      return;
+    }
+    --itemsToPop;
+
+    Texture::freeSurface(rsrcSurface.second);
+  }
 
-#if LOCAL_DEBUG
-  LOGY("Executing destroyTexture_RT(), rsrcId: %zu (with %zu bytes of "
-       "data)",
-      rsrcId, sizeof(rsrcId));
-#endif /* LOCAL_DEBUG */
+  _containers->releaseSurfaceLoadBatch(surfaceBatch);
+}
+
+void Renderer::destroyTexture_RT() {
+  const uint64_t rsrcId =
+      readRendererCmdPayload_RT<DestroyTexturePayload>().rsrcId;
 
   SDL_Texture *texture = nullptr;
   _containers->getRsrcTexture(rsrcId, texture);
 
+  _softwareTextures.forget(texture);
   Texture::freeTexture(texture);
   _containers->detachRsrcTexture(rsrcId);
 }
 
 void Renderer::createFBO_RT() {
-  int32_t width = 0;
-  int32_t height = 0;
-  int32_t containerId = 0;
-
-  _rendererState[_renderStateIdx].renderData >> width >> height >> containerId;
-
-#if LOCAL_DEBUG
-  LOGY("Executing createFBO_RT(), width: %d, height: %d, containerId: %d "
-       "(with %zu bytes of data)", width, height, containerId,
-       (sizeof(width) + sizeof(height) + sizeof(containerId)));
-#endif /* LOCAL_DEBUG */
+  const auto payload = readRendererCmdPayload_RT<CreateFboPayload>();
 
   SDL_Texture *texture = nullptr;
 
   // allocate new empty Texture
   if (ErrorCode::SUCCESS !=
-      Texture::createEmptyTexture(width, height, texture)) {
+      Texture::createEmptyTexture(payload.width, payload.height, texture)) {
     LOGERR("Texture::createEmptyTexture() failed");
     return;
   }
 
-  _containers->attachFbo(containerId, width, height, texture);
+  _containers->attachFbo(payload.containerId, payload.width, payload.height,
+                         texture);
 }
 
 void Renderer::destroyFBO_RT() {
-  int32_t containerId = 0;
-  _rendererState[_renderStateIdx].renderData >> containerId;
-
-#if LOCAL_DEBUG
-  LOGY("Executing destroyFBO_RT(), containerId: %d (with %zu bytes of data)",
-       containerId, sizeof(containerId));
-#endif /* LOCAL_DEBUG */
+  const int32_t containerId =
+      readRendererCmdPayload_RT<DestroyFboPayload>().containerId;
 
   SDL_Texture *texture = nullptr;
   _containers->getFboTexture(containerId, texture);
@@ -778,13 +1044,8 @@ void Renderer::destroyFBO_RT() {
 void Renderer::changeRendererTarget_RT() {
   SDL_Texture *texture = nullptr;
 
-  int32_t containerId = 0;
-  _rendererState[_renderStateIdx].renderData >> containerId;
-
-#if LOCAL_DEBUG
-  LOGY("Executing changeRendererTarget_RT(), containerId: %d (with %zu bytes "
-       "of data)", containerId, sizeof(containerId));
-#endif /* LOCAL_DEBUG */
+  const int32_t containerId =
+      readRendererCmdPayload_RT<ChangeRendererTargetPayload>().containerId;
 
   _containers->getFboTexture(containerId, texture);
 
@@ -795,10 +1056,6 @@ void Renderer::changeRendererTarget_RT() {
 }
 
 void Renderer::resetRendererTarget_RT() {
-#if LOCAL_DEBUG
-  LOGY("Executing resetRendererTarget_RT() (with 0 bytes of data)");
-#endif /* LOCAL_DEBUG */
-
   if (ErrorCode::SUCCESS != Texture::setRendererTarget(nullptr))
   {
     LOGERR("Error, default renderer target could not be set. "
@@ -807,18 +1064,8 @@ void Renderer::resetRendererTarget_RT() {
 }
 
 void Renderer::clearRendererTarget_RT() {
-  // note: there is no default constructor for color, the Colors::BLACK
-  // is just for initialisation
-  Color clearColor = Colors::BLACK;
-
-  _rendererState[_renderStateIdx].renderData >> clearColor;
-
-#if LOCAL_DEBUG
-  LOGY(
-      "Executing clearRendererTarget_RT(), clerColor32BitRGBA: %u (with %zu "
-      "bytes of data",
-      clearColor.get32BitRGBA(), sizeof(clearColor));
-#endif /* LOCAL_DEBUG */
+  const Color clearColor =
+      readRendererCmdPayload_RT<ClearRendererTargetPayload>().clearColor;
 
   if (ErrorCode::SUCCESS != Texture::clearCurrentRendererTarget(clearColor)) {
     LOGERR("Error in Texture::clearCurrentRendererTarget()");
@@ -826,76 +1073,94 @@ void Renderer::clearRendererTarget_RT() {
 }
 
 void Renderer::updateRendererTarget_RT() {
-  uint32_t itemsSize = 0;
-  _rendererState[_renderStateIdx].renderData >> itemsSize;
-  const uint64_t DATA_TO_READ = itemsSize * sizeof(DrawParams);
-
-#if LOCAL_DEBUG
-  LOGY("Executing updateRendererTarget_RT(), itemsSize: %u (with %zu bytes of"
-       " data)", itemsSize, sizeof(DATA_TO_READ) + sizeof(itemsSize));
-#endif /* LOCAL_DEBUG */
+  const uint32_t itemsSize =
+      readRendererCmdPayload_RT<UpdateRendererTargetPayload>().itemsCount;
 
-  DrawParams *storedItems = new DrawParams[itemsSize];
+  const uint8_t *storedItems =
+      acquireRendererData_RT(itemsSize * sizeof(DrawParams));
   if (nullptr == storedItems) {
-    LOGERR("Error, bad alloc for DrawParams()");
     return;
   }
 
-  if (DATA_TO_READ !=
-      _rendererState[_renderStateIdx].renderData.read(
-          reinterpret_cast<uint8_t *>(storedItems), DATA_TO_READ)) {
-    LOGERR(
-        "Warning, Circular buffer overflow(read data requested is "
-        "bigger than buffer capacity)! ");
+  // the frame could be bigger than the initial capacity
+  if (itemsSize > _fboWidgets.capacity()) {
+    _fboWidgets.resize(itemsSize);
+  }
+
+  // the view is not aligned -> memcpy() is the portable unaligned load
+  DrawParams drawParams;
+  for (uint32_t i = 0; i < itemsSize; ++i) {
+    memcpy(&drawParams, storedItems + (i * sizeof(DrawParams)),
+           sizeof(DrawParams));
+    _fboWidgets.setDrawParams(i, drawParams);
+  }
+
+  drawFboWidgets_RT(itemsSize);
+}
 
-    delete[] storedItems;
-    storedItems = nullptr;
+void Renderer::updateRendererTargetPacked_RT() {
+  const auto payload =
+      readRendererCmdPayload_RT<UpdateRendererTargetPackedPayload>();
+  const uint32_t itemsSize = payload.itemsCount;
 
+  // decode directly from the renderData
+  const uint8_t *encodedItems = acquireRendererData_RT(payload.encodedBytes);
+  if (nullptr == encodedItems) {
     return;
   }
 
-  drawWidgetsToBackBuffer_RT(storedItems, itemsSize);
+  // the frame could be bigger than the initial capacity
+  if (itemsSize > _fboWidgets.capacity()) {
+    _fboWidgets.resize(itemsSize);
+  }
+
+  DrawParams drawParams;
+  uint64_t parsedBytes = 0;
+  for (uint32_t i = 0; i < itemsSize; ++i) {
+    parsedBytes += DrawParamsCodec::decode(encodedItems + parsedBytes,
+                                           drawParams);
+    _fboWidgets.setDrawParams(i, drawParams);
+  }
 
-  delete[] storedItems;
-  storedItems = nullptr;
+  drawFboWidgets_RT(itemsSize);
 }
 
-void Renderer::changeTextureBlending_RT() {
-  WidgetType widgetType = WidgetType::UNKNOWN;
-  BlendMode blendmode = BlendMode::NONE;
-  [[maybe_unused]]uint64_t parsedBytes = 0;
+void Renderer::drawFboWidgets_RT(uint32_t widgetsSize) {
+  if (_isViewportCullingEnabled) {
+    widgetsSize = cullWidgets_RT(_fboWidgets, widgetsSize);
+  }
 
-  _rendererState[_renderStateIdx].renderData >> widgetType >> blendmode;
-  parsedBytes += (sizeof(widgetType) + sizeof(blendmode));
+  LayerSorter::sort(_fboWidgets, widgetsSize,
+                    _rendererState[_renderStateIdx].frameArena);
+
+  resolveWidgetTextures_RT(_fboWidgets, widgetsSize);
+  drawWidgetsToBackBuffer_RT(_fboWidgets, widgetsSize);
+}
+
+void Renderer::changeTextureBlending_RT() {
+  const auto payload =
+      readRendererCmdPayload_RT<ChangeTextureBlendModePayload>();
+  const WidgetType widgetType = payload.widgetType;
+  const BlendMode blendmode = payload.blendMode;
 
   SDL_Texture *texture = nullptr;
 
   if (WidgetType::IMAGE == widgetType) {
-    uint64_t rsrcId = 0;
-    _rendererState[_renderStateIdx].renderData >> rsrcId;
-    parsedBytes += sizeof(rsrcId);
+    const uint64_t rsrcId = readRendererCmdPayload_RT<
+        ChangeTextureBlendModeImagePayload>().rsrcId;
 
     _containers->getRsrcTexture(rsrcId, texture);
-  } else if (WidgetType::TEXT == widgetType) {
-    int32_t containerId = 0;
-    _rendererState[_renderStateIdx].renderData >> containerId;
-    parsedBytes += sizeof(containerId);
-
-    _containers->getTextTexture(containerId, texture);
-  } else { // WidgetType::SPRITE_BUFFER == widgetType
-    int32_t containerId = 0;
-    _rendererState[_renderStateIdx].renderData >> containerId;
-    parsedBytes += sizeof(containerId);
+  } else {
+    const int32_t containerId = readRendererCmdPayload_RT<
+        ChangeTextureBlendModeContainerPayload>().containerId;
 
-    _containers->getFboTexture(containerId, texture);
+    if (WidgetType::TEXT == widgetType) {
+      _containers->getTextTexture(containerId, texture);
+    } else { // WidgetType::SPRITE_BUFFER == widgetType
+      _containers->getFboTexture(containerId, texture);
+    }
   }
 
-#if LOCAL_DEBUG
-  LOGY("Executing changeTextureBlending_RT(), widgetType: %hhu, blendmode: %hhu"
-       " (with %zu bytes of data)",
-       getEnumValue(widgetType), getEnumValue(blendmode), parsedBytes);
-#endif /* LOCAL_DEBUG */
-
   if (ErrorCode::SUCCESS != Texture::setBlendMode(texture, blendmode)) {
     LOGERR("Error in Texture::setBlendMode() for  blendMode: %hhu",
         getEnumValue(blendmode));
@@ -903,22 +1168,10 @@ void Renderer::changeTextureBlending_RT() {
 }
 
 void Renderer::changeTextureOpacity_RT() {
-  WidgetType widgetType = WidgetType::UNKNOWN;
-  int32_t opacity = 0;
-  int32_t containerId = 0;
-
-  _rendererState[_renderStateIdx].renderData >> widgetType >> opacity >>
-      containerId;
-
-#if LOCAL_DEBUG
-  const uint64_t parsedBytes =
-      sizeof(widgetType) + sizeof(opacity) + sizeof(containerId);
-
-  LOGY(
-      "Executing changeTextureOpacity_RT(), widgetType: %hhu, opacity: %d "
-      "(with %zu bytes of data)",
-      getEnumValue(widgetType), opacity, parsedBytes);
-#endif /* LOCAL_DEBUG */
+  const auto payload = readRendererCmdPayload_RT<ChangeTextureOpacityPayload>();
+  const WidgetType widgetType = payload.widgetType;
+  const int32_t opacity = payload.opacity;
+  const int32_t containerId = payload.containerId;
 
   SDL_Texture *texture = nullptr;
 
@@ -936,11 +1189,12 @@ void Renderer::changeTextureOpacity_RT() {
    * all of them.
    *
    * Images address this issue by simply storing their opacity as a
-   * number and in the moment of actual draw call -> if the opacity is
-   * different that FULL_OPACITY:
-   *     - a local change in opacity is made;
-   *     - the draw call is made;
-   *     - restore to FULL_OPACITY is made;
+   * number. Every draw call sets it as the alpha modulation of the
+   * resource through the RenderStateCache (see drawWidget_RT()):
+   *     - the SDL call is made only if the cached alpha of the resource
+   *       is different;
+   *     - the alpha is not restored after the draw. It stays until a
+   *       draw with a different opacity changes it;
    * */
   if (WidgetType::TEXT == widgetType) {
     _containers->getTextTexture(containerId, texture);
@@ -956,337 +1210,557 @@ void Renderer::changeTextureOpacity_RT() {
   Texture::setAlpha(texture, opacity);
 }
 
-void Renderer::createTTFText_RT(const bool isTextBeingReloaded) {
-  uint64_t fontId = 0;
-  uint64_t textLength = 0;
-  int32_t containerId = 0;
-  int32_t createdWidth = 0;
-  int32_t createdHeight = 0;
-
-  // note: there is no default constructor for color, the Colors::BLACK
-  // is just for initialisation
-  Color textColor = Colors::BLACK;
-  SDL_Texture *texture = nullptr;
-
-  [[maybe_unused]]uint64_t parsedBytes = sizeof(fontId) + sizeof(textColor) +
-                                         sizeof(textLength) + textLength;
+void Renderer::createTTFText_RT() {
+  loadTTFText_RT(readRendererCmdPayload_RT<CreateTTFTextPayload>());
+}
 
-  if (isTextBeingReloaded) {
-    // the containerId remains the same when text is reloaded
-    containerId = destroyTTFText_RT();
-  } else {
-    // fresh new containerId -> read it from renderData
-    _rendererState[_renderStateIdx].renderData >> containerId;
-    parsedBytes += sizeof(containerId);
-  }
+void Renderer::reloadTTFText_RT() {
+  const auto payload = readRendererCmdPayload_RT<ReloadTTFTextPayload>();
 
-  _rendererState[_renderStateIdx].renderData >> fontId >> textColor >>
-    textLength;
+  // the containerId remains the same when text is reloaded
+  destroyTTFTextTexture_RT(payload.containerId);
+  loadTTFText_RT(payload);
+}
 
-  //+1 to leave space for manually populating the terminating null character
-  char *textContent = new char[textLength + 1];
+void Renderer::loadTTFText_RT(const CreateTTFTextPayload &payload) {
+  const char *textContent = readRendererStr_RT(payload.textLength);
   if (nullptr == textContent) {
-    LOGERR("Error, bad alloc for textContent");
     return;
   }
 
-  textContent[textLength] = '\0';
-
-  if (textLength != _rendererState[_renderStateIdx].renderData.read(
-          reinterpret_cast<uint8_t*>(textContent), textLength)) {
-    LOGERR(
-        "Warning, Circular buffer overflow(read data requested is "
-        "bigger than buffer capacity)!");
-
-    delete[] textContent;
-    textContent = nullptr;
+  int32_t createdWidth = 0;
+  int32_t createdHeight = 0;
+  SDL_Texture *texture = nullptr;
 
+  if (ErrorCode::SUCCESS != Texture::loadFromText(textContent,
+          (*_containers->getFontsMap())[payload.fontId], payload.textColor,
+          texture, createdWidth, createdHeight)) {
+    LOGERR("Error in loadFromText() for fontId: %" PRIu64, payload.fontId);
     return;
   }
 
-#if LOCAL_DEBUG
-  LOGY("Executing cteateTTFText_RT(), contaierID: %d, fontId: %zu, "
-       "textColor.32bitRGBA: %u, textLenght: %zu, textContent: %s (with %zu "
-       "bytes of data)", containerId, fontId, textColor.get32BitRGBA(),
-       textLength, textContent, parsedBytes);
-#endif /* LOCAL_DEBUG */
+  _containers->attachText(payload.containerId, createdWidth, createdHeight,
+                          texture);
+}
 
-  if (ErrorCode::SUCCESS !=
-      Texture::loadFromText(textContent, (*_containers->getFontsMap())[fontId],
-                           textColor, texture, createdWidth, createdHeight)) {
-    LOGERR("Error in loadFromText() for fontId: %" PRIu64, fontId);
+void Renderer::destroyTTFText_RT() {
+  destroyTTFTextTexture_RT(
+      readRendererCmdPayload_RT<DestroyTTFTextPayload>().containerId);
+}
 
-    delete[] textContent;
-    textContent = nullptr;
+void Renderer::destroyTTFTextTexture_RT(const int32_t containerId) {
+  SDL_Texture *texture = nullptr;
 
-    return;
-  }
+  _containers->getTextTexture(containerId, texture);
+  _softwareTextures.forget(texture);
+  Texture::freeTexture(texture);
+  _containers->detachText(containerId);
+}
 
-  _containers->attachText(containerId, createdWidth, createdHeight, texture);
+bool Renderer::readRendererData_RT(uint8_t *outData, const uint64_t bytes) {
+  if (bytes != _rendererState[_renderStateIdx].renderData.read(outData,
+                                                               bytes)) {
+    LOGERR("Warning, Circular buffer overflow(read data requested is "
+           "bigger than buffer capacity)!");
+    return false;
+  }
 
-  delete[] textContent;
-  textContent = nullptr;
+  return true;
 }
 
-int32_t Renderer::destroyTTFText_RT() {
-  int32_t containerId = 0;
-  _rendererState[_renderStateIdx].renderData >> containerId;
+const uint8_t *Renderer::acquireRendererData_RT(const uint64_t bytes) {
+  RenderDataBuffer &renderData = _rendererState[_renderStateIdx].renderData;
 
-#if LOCAL_DEBUG
-  LOGY("Executing destroyTTFText_RT(), containerId: %d (with %zu bytes of "
-       "data)", containerId, sizeof(containerId));
-#endif /* LOCAL_DEBUG */
+  // the common case - the frame data does not wrap
+  const uint8_t *view = renderData.peekContiguous(bytes);
+  if (nullptr != view) {
+    renderData.consume(bytes);
+    return view;
+  }
 
-  SDL_Texture *texture = nullptr;
+  uint8_t *data = _rendererState[_renderStateIdx].frameArena.
+      allocateArray<uint8_t>(bytes);
+  if (!readRendererData_RT(data, bytes)) {
+    return nullptr;
+  }
 
-  _containers->getTextTexture(containerId, texture);
-  Texture::freeTexture(texture);
-  _containers->detachText(containerId);
+  return data;
+}
 
-  return containerId;
+const char *Renderer::readRendererStr_RT(const uint64_t strLength) {
+  //+1 to leave space for manually populating the terminating null character
+  char *str = _rendererState[_renderStateIdx].frameArena.
+      allocateArray<char>(strLength + 1);
+  if (!readRendererData_RT(reinterpret_cast<uint8_t*>(str), strLength)) {
+    return nullptr;
+  }
+
+  str[strLength] = '\0';
+  return str;
 }
 
-void Renderer::drawWidgetsToBackBuffer_RT(const DrawParams drawParamsArr[],
+void Renderer::drawWidgetsToBackBuffer_RT(const FrameWidgets &widgets,
                                           const uint32_t size) {
-  SDL_Texture *texture = nullptr;
-
-  for (uint32_t i = 0; i < size; ++i) {
-    if (WidgetType::IMAGE == drawParamsArr[i].widgetType) {
-      // for performance reasons look-up is not checked whether an
-      // element is found or not. An error should be
-      // caught already on init()/create()
-      _containers->getRsrcTexture(drawParamsArr[i].rsrcId, texture);
-
-      if (FULL_OPACITY == drawParamsArr[i].opacity) {
-        Texture::draw(texture, drawParamsArr[i]);
-      } else  // FULL_OPACITY != _widgets[i]
-      {
-        /** Since several Widgets could be sharing the same graphical
-         * resource loaded into memory - the resource opacity could
-         * not be left changed by a single widget. This will result
-         * in abnormal behavior for the other widget that are using
-         * the same graphical resource.
-         * */
-
-        // change opacity, perform draw and restore full opacity
-        Texture::setAlpha(texture, drawParamsArr[i].opacity);
-        Texture::draw(texture, drawParamsArr[i]);
-        Texture::setAlpha(texture, FULL_OPACITY);
+  if (DrawBackend::BATCHED_GEOMETRY == _drawBackend) {
+    for (uint32_t i = 0; i < size; ++i) {
+      if (!_drawBatcher.addWidget(widgets, i)) {
+        // preserve the draw order
+        _drawBatcher.flush();
+        drawWidget_RT(widgets.texture[i], widgets.getDrawParams(i));
+
+        // the batched geometry should not be clipped by the widget crop
+        Texture::resetClipRect();
       }
-    } else if (WidgetType::TEXT == drawParamsArr[i].widgetType) {
-      // for performance reasons look-up is not checked whether an
-      // element is found or not. An error should be
-      // caught already on init()/create()
-      _containers->getTextTexture(drawParamsArr[i].spriteBufferId, texture);
-
-      Texture::draw(texture, drawParamsArr[i]);
-    } else  // WidgetType::SPRITE_BUFFER ==
-            //         _rendererState[_renderStateIdx].widgets[i].widgetType)
-    {
-      _containers->getFboTexture(
-          drawParamsArr[i].spriteBufferId, texture);
-
-      Texture::draw(texture, drawParamsArr[i]);
     }
+    _drawBatcher.flush();
+    return;
+  }
+
+  for (uint32_t i = 0; i < size; ++i) {
+    drawWidget_RT(widgets.texture[i], widgets.getDrawParams(i));
   }
 }
 
-void Renderer::takeScreenshot_RT() {
-  ScreenshotContainer screenshotContainer = ScreenshotContainer::PNG;
-  int32_t quality = 0;
-  uint64_t textLength = 0;
+bool Renderer::rasterizeWidgetsToBackBuffer_RT(const FrameWidgets &widgets,
+                                               const uint32_t size) {
+  RasterSource *sources = _rendererState[_renderStateIdx].frameArena.
+      allocateArray<RasterSource>(size);
+  const bool isSupported = populateRasterSources_RT(widgets, size, sources);
 
-  _rendererState[_renderStateIdx].renderData >> screenshotContainer
-                                             >> quality >> textLength;
-  [[maybe_unused]]const uint64_t parsedBytes =
-      sizeof(screenshotContainer) + sizeof(quality) + sizeof(textLength)
-      + textLength;
+  // the textures are read back through a temporary renderer target
+  resetRendererTarget_RT();
+  if (!isSupported) {
+    return false;
+  }
 
-  //+1 to leave space for manually populating the terminating null character
-  char *textContent = new char[textLength + 1];
-  if (nullptr == textContent) {
-    LOGERR("Error, bad alloc for textContent");
-    return;
+  SDL_Rect viewport = { 0, 0, 0, 0 };
+  SDL_RenderGetViewport(_sdlRenderer, &viewport);
+  if ((0 >= viewport.w) || (0 >= viewport.h)) {
+    return false;
   }
 
-  textContent[textLength] = '\0';
+  if ((viewport.w != _tiledScreenWidth) ||
+      (viewport.h != _tiledScreenHeight)) {
+    Texture::freeTexture(_tiledScreenTexture);
+    _tiledScreenTexture = SDL_CreateTexture(_sdlRenderer,
+        SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, viewport.w,
+        viewport.h);
+    if (nullptr == _tiledScreenTexture) {
+      LOGERR("SDL_CreateTexture() failed: %s", SDL_GetError());
+      _tiledScreenWidth = 0;
+      _tiledScreenHeight = 0;
+      return false;
+    }
 
-  if (textLength != _rendererState[_renderStateIdx].renderData.read(
-                        reinterpret_cast<uint8_t *>(textContent), textLength)) {
-    LOGERR("Warning, Circular buffer overflow(read data requested is "
-           "bigger than buffer capacity)!");
-    delete[] textContent;
-    textContent = nullptr;
-    return;
+    // the rasterised frame replaces the renderer target content
+    SDL_SetTextureBlendMode(_tiledScreenTexture, SDL_BLENDMODE_NONE);
+    _tiledScreenWidth = viewport.w;
+    _tiledScreenHeight = viewport.h;
+    _tiledScreenPixels.resize(
+        static_cast<size_t>(viewport.w) * viewport.h);
   }
 
-#if LOCAL_DEBUG
-  LOGY("Executing takeScreenshot_RT(), screenshotContainer: %hhu, quality: %d, "
-       "textLenght: %zu, textContent: %s (with %zu "
-       "bytes of data)", getEnumValue(screenshotContainer), quality, textLength,
-       textContent, parsedBytes);
-#endif /* LOCAL_DEBUG */
+  const uint32_t clearColor = (static_cast<uint32_t>(_clearColor.rgba.a) << 24)
+      | (static_cast<uint32_t>(_clearColor.rgba.r) << 16)
+      | (static_cast<uint32_t>(_clearColor.rgba.g) << 8)
+      | static_cast<uint32_t>(_clearColor.rgba.b);
+  const RasterSurface target { _tiledScreenPixels.data(), viewport.w,
+                               viewport.h, viewport.w };
+  _tiledRasterizer.rasterize(widgets, size, sources, clearColor, target);
+
+  constexpr int32_t bytesPerPixel = static_cast<int32_t>(sizeof(uint32_t));
+  if (EXIT_SUCCESS != SDL_UpdateTexture(_tiledScreenTexture, nullptr,
+          _tiledScreenPixels.data(), viewport.w * bytesPerPixel)) {
+    LOGERR("Error in SDL_UpdateTexture(), SDL Error: %s", SDL_GetError());
+    return false;
+  }
 
-  if (ErrorCode::SUCCESS !=
-      Texture::takeScreenshot(textContent, screenshotContainer, quality)) {
-    LOGERR("Error, takeScreenshot() failed for file: [%s]", textContent);
-    delete[] textContent;
-    textContent = nullptr;
-    return;
+  Texture::resetClipRect();
+  if (EXIT_SUCCESS != SDL_RenderCopy(_sdlRenderer, _tiledScreenTexture,
+                                     nullptr, nullptr)) {
+    LOGERR("Error in SDL_RenderCopy(), SDL Error: %s", SDL_GetError());
+    return false;
   }
 
-  delete[] textContent;
-  textContent = nullptr;
+  return true;
 }
 
-void Renderer::enableDisableMultithreadTextureLoading_RT() {
-  _rendererState[_renderStateIdx].renderData >>
-      _isMultithreadTextureLoadingEnabled;
+bool Renderer::populateRasterSources_RT(const FrameWidgets &widgets,
+                                        const uint32_t size,
+                                        RasterSource *outSources) {
+  for (uint32_t i = 0; i < size; ++i) {
+    outSources[i] = RasterSource();
+
+    // the FBO content changes between the frames
+    if (WidgetType::SPRITE_BUFFER == widgets.widgetType[i]) {
+      return false;
+    }
 
-#if LOCAL_DEBUG
-  LOGY("Executing enableDisableMultithreadTextureLoading_RT(), "
-       "_isMultithreadTextureLoadingEnabled: %d (with %zu bytes of data)",
-       _isMultithreadTextureLoadingEnabled,
-       sizeof(_isMultithreadTextureLoadingEnabled));
-#endif /* LOCAL_DEBUG */
+    // not drawn at all
+    SDL_Texture *texture = widgets.texture[i];
+    if (nullptr == texture) {
+      continue;
+    }
+
+    const SoftwareTexture *softwareTexture =
+        _softwareTextures.acquire(texture);
+    if (nullptr == softwareTexture) {
+      return false;
+    }
+
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    uint8_t alphaMod = FULL_OPACITY;
+    if ((EXIT_SUCCESS != SDL_GetTextureBlendMode(texture, &blendMode)) ||
+        (EXIT_SUCCESS != SDL_GetTextureAlphaMod(texture, &alphaMod))) {
+      return false;
+    }
+
+    RasterSource &source = outSources[i];
+    source.pixels = softwareTexture->pixels.data();
+    source.width = softwareTexture->width;
+    source.height = softwareTexture->height;
+    source.pitch = softwareTexture->width;
+    source.blendMode = static_cast<BlendMode>(blendMode);
+
+    // the IMAGE opacity is applied on every draw (see ::drawWidget_RT())
+    source.alphaMod = (WidgetType::IMAGE == widgets.widgetType[i]) ?
+        static_cast<uint8_t>(widgets.opacity[i]) : alphaMod;
+
+    if (!TiledRasterizer::isWidgetSupported(widgets, i, source)) {
+      return false;
+    }
+  }
+
+  return true;
 }
 
-void Renderer::applyGlobalOffsets_RT(const uint32_t widgetsSize) {
-  const int32_t idx = _renderStateIdx;
+void Renderer::reorderWidgets_RT(const uint32_t widgetsSize) {
+  RendererState &state = _rendererState[_renderStateIdx];
 
-  if (0 != _rendererState[idx].globalOffsetX) {
-    // copy the variable because of cache reuse
-    const int32_t OFFSET_X = _rendererState[idx].globalOffsetX;
+  _drawReorderer.reorder(state.widgets, widgetsSize,
+      state.lastDrawStats.textureSwitchesBeforeReorder,
+      state.lastDrawStats.textureSwitchesAfterReorder);
+}
 
-    for (uint32_t i = 0; i < widgetsSize; ++i) {
-      if (!_rendererState[idx].widgets[i].hasCrop) {
-        _rendererState[idx].widgets[i].pos.x += OFFSET_X;
-      } else {
-        _rendererState[idx].widgets[i].frameCropRect.x += OFFSET_X;
+uint32_t Renderer::cullWidgets_RT(FrameWidgets &widgets,
+                                  const uint32_t widgetsSize) {
+  // drawing coordinates are relative to the viewport of the current target
+  SDL_Rect viewport = { 0, 0, 0, 0 };
+  SDL_RenderGetViewport(_sdlRenderer, &viewport);
+
+  const uint32_t visibleCount = _viewportCuller.cull(widgets, widgetsSize,
+      Rectangle(0, 0, viewport.w, viewport.h));
+  _frameCulledWidgets += widgetsSize - visibleCount;
+
+  return visibleCount;
+}
+
+uint32_t Renderer::applyStaticLayers_RT(FrameWidgets &widgets,
+                                        const uint32_t widgetsSize) {
+  // the cached layers could hold the old content of the textures
+  if (_hasImageTextureChanges) {
+    _staticLayerCache.invalidate();
+    _hasImageTextureChanges = false;
+  }
+
+  _staticLayerCache.update(widgets, widgetsSize);
+
+  SDL_Rect viewport = { 0, 0, 0, 0 };
+  SDL_RenderGetViewport(_sdlRenderer, &viewport);
+
+  FrameDrawStats &drawStats = _rendererState[_renderStateIdx].lastDrawStats;
+  drawStats.staticLayers = 0;
+  drawStats.staticLayerWidgets = 0;
+
+  for (uint32_t i = 0; i < StaticLayerCache::MAX_LAYERS; ++i) {
+    const StaticLayer &layer = _staticLayerCache.getLayer(i);
+    if (!layer.isValid) {
+      continue;
+    }
+
+    if (layer.needsRender) {
+      SDL_Texture *target = _staticLayerCache.beginLayerRender(i, widgets,
+          viewport.w, viewport.h);
+      if (nullptr == target) {
+        continue;
+      }
+
+      if (ErrorCode::SUCCESS != Texture::setRendererTarget(target)) {
+        LOGERR("Error, static layer: %u could not be rendered", i);
+        continue;
+      }
+
+      if (ErrorCode::SUCCESS !=
+          Texture::clearCurrentRendererTarget(Colors::FULL_TRANSPARENT)) {
+        LOGERR("Error in Texture::clearCurrentRendererTarget()");
       }
+      const uint32_t endIdx = layer.startIdx + layer.widgetsCount;
+      for (uint32_t row = layer.startIdx; row < endIdx; ++row) {
+        drawWidget_RT(widgets.texture[row], widgets.getDrawParams(row));
+      }
+      resetRendererTarget_RT();
+
+      _staticLayerCache.finishLayerRender(i);
+      ++_staticLayerRenders;
     }
+
+    ++drawStats.staticLayers;
+    drawStats.staticLayerWidgets += layer.widgetsCount;
   }
 
-  if (0 != _rendererState[idx].globalOffsetY) {
-    // copy the variable because of cache reuse
-    const int32_t OFFSET_Y = _rendererState[idx].globalOffsetY;
+  return _staticLayerCache.substitute(widgets, widgetsSize);
+}
 
-    for (uint32_t i = 0; i < widgetsSize; ++i) {
-      if (!_rendererState[idx].widgets[i].hasCrop) {
-        _rendererState[idx].widgets[i].pos.y += OFFSET_Y;
+void Renderer::resolveWidgetTextures_RT(FrameWidgets &widgets,
+                                        const uint32_t widgetsSize) const {
+  // for performance reasons look-up is not checked whether an
+  // element is found or not. An error should be
+  // caught already on init()/create()
+  for (uint32_t i = 0; i < widgetsSize; ++i) {
+    SDL_Texture *&texture = widgets.texture[i];
+    const uint64_t containerId = widgets.containerId[i];
+
+    if (WidgetType::IMAGE == widgets.widgetType[i]) {
+      const RsrcHandle rsrcHandle = widgets.rsrcHandle[i];
+      if (INVALID_RSRC_HANDLE != rsrcHandle) {
+        _containers->getRsrcTexture(rsrcHandle, containerId, texture);
       } else {
-        _rendererState[idx].widgets[i].frameCropRect.y += OFFSET_Y;
+        _containers->getRsrcTexture(containerId, texture);
       }
+    } else if (WidgetType::TEXT == widgets.widgetType[i]) {
+      _containers->getTextTexture(static_cast<int32_t>(containerId), texture);
+    } else { // WidgetType::SPRITE_BUFFER == widgets.widgetType[i]
+      _containers->getFboTexture(static_cast<int32_t>(containerId), texture);
     }
   }
 }
 
-bool Renderer::executeRenderCommandsInternal() {
-  const RendererState &state = _rendererState[_renderStateIdx];
-  const uint32_t commandCounter = state.currRendererCmdsCounter;
+void Renderer::drawWidget_RT(SDL_Texture *texture,
+                             const DrawParams &drawParams) {
+  if (WidgetType::IMAGE != drawParams.widgetType) {
+    Texture::draw(texture, drawParams);
+    return;
+  }
 
-  for (uint32_t idx = 0; idx < commandCounter; ++idx) {
-#if LOCAL_DEBUG
-    LOGY_ON_SAME_LINE("command counter: %u. ", cmdIdx);
-#endif /* LOCAL_DEBUG */
+  /** Since several Widgets could be sharing the same graphical
+   * resource loaded into memory - the resource opacity is applied for
+   * every single draw call.
+   *
+   * The opacity is not restored after the draw. It is changed (only if
+   * different) by the next draw of the same resource, so consecutive
+   * widgets with the same opacity do not touch it at all.
+   * */
+  Texture::setAlpha(texture, drawParams.opacity);
+  Texture::draw(texture, drawParams);
+}
+
+void Renderer::takeScreenshot_RT() {
+  const auto payload = readRendererCmdPayload_RT<TakeScreenshotPayload>();
+
+  // the replayed commands hold the screenshot ids of the captured session.
+  // Don't complete the live requests with them
+  const uint64_t screenshotId =
+      _rendererState[_renderStateIdx].isReplayedFrame
+          ? _screenshotEncoder.registerScreenshot(nullptr)
+          : payload.screenshotId;
+
+  const char *file = readRendererStr_RT(payload.fileLength);
+  if (nullptr == file) {
+    std::vector<uint8_t> noBuffer;
+    _screenshotEncoder.cancel(screenshotId, "", noBuffer);
+    return;
+  }
 
-    switch (state.rendererCmd[idx]) {
-    case RendererCmd::CLEAR_SCREEN:
-      clearScreenExecution_RT();
-      break;
+  // the pixels are read back, once the frame is drawn
+  _screenshotRequests.push_back(ScreenshotRequest { file, payload.container,
+      payload.quality, screenshotId });
+}
 
-    case RendererCmd::FINISH_FRAME:
-      finishFrameExecution_RT();
-      break;
+void Renderer::captureScreenshots_RT() {
+  SDL_Rect viewport = { 0, 0, 0, 0 };
+  SDL_RenderGetViewport(_sdlRenderer, &viewport);
 
-    case RendererCmd::CHANGE_CLEAR_COLOR:
-      changeClearColor_RT();
-      break;
+  constexpr int32_t bytesPerPixel = 4;
+  const uint64_t bytes =
+      static_cast<uint64_t>(viewport.w) * viewport.h * bytesPerPixel;
 
-    case RendererCmd::LOAD_TEXTURE_SINGLE:
-      loadTextureSingle_RT();
-      break;
+  for (ScreenshotRequest &request : _screenshotRequests) {
+    if (0 == bytes) {
+      LOGERR("Warning, screenshot [%s] is dropped. The renderer viewport "
+             "is empty", request.file.c_str());
+      _screenshotEncoder.drop(request.screenshotId, request.file.c_str());
+      continue;
+    }
 
-    case RendererCmd::LOAD_TEXTURE_MULTIPLE:
-      loadTextureMultiple_RT();
-      break;
+    ScreenshotJob job;
+    if (!_screenshotEncoder.tryAcquireBuffer(bytes, job.pixels)) {
+      LOGERR("Warning, screenshot [%s] is dropped. Too many screenshots are "
+             "still being encoded. Consider increasing "
+             "maxPendingScreenshots from the configuration",
+             request.file.c_str());
+      _screenshotEncoder.cancel(request.screenshotId, request.file.c_str(),
+                                job.pixels);
+      continue;
+    }
 
-    case RendererCmd::DESTROY_TEXTURE:
-      destroyTexture_RT();
-      break;
+    // the only part of the screenshot, left on the renderer thread
+    if (EXIT_SUCCESS != SDL_RenderReadPixels(_sdlRenderer, nullptr,
+            SDL_PIXELFORMAT_ARGB8888, job.pixels.data(),
+            viewport.w * bytesPerPixel)) {
+      LOGERR("SDL_RenderReadPixels() failed: %s", SDL_GetError());
+      _screenshotEncoder.cancel(request.screenshotId, request.file.c_str(),
+                                job.pixels);
+      continue;
+    }
 
-    case RendererCmd::CREATE_FBO:
-      createFBO_RT();
-      break;
+    job.width = viewport.w;
+    job.height = viewport.h;
+    job.file = std::move(request.file);
+    job.container = request.container;
+    job.quality = request.quality;
+    job.screenshotId = request.screenshotId;
+    _screenshotEncoder.submit(std::move(job));
+  }
 
-    case RendererCmd::DESTROY_FBO:
-      destroyFBO_RT();
-      break;
+  _screenshotRequests.clear();
+}
 
-    case RendererCmd::CHANGE_RENDERER_TARGET:
-      changeRendererTarget_RT();
-      break;
+void Renderer::exportSharedFrame_RT() {
+  // nobody is reading - don't pay for the readback
+  if (!_sharedFrameWriter.hasConsumers()) {
+    return;
+  }
 
-    case RendererCmd::RESET_RENDERER_TARGET:
-      resetRendererTarget_RT();
-      break;
+  SDL_Rect viewport = { 0, 0, 0, 0 };
+  SDL_RenderGetViewport(_sdlRenderer, &viewport);
 
-    case RendererCmd::CLEAR_RENDERER_TARGET:
-      clearRendererTarget_RT();
-      break;
+  uint8_t *pixels = _sharedFrameWriter.beginFrame(viewport.w, viewport.h);
+  if (nullptr == pixels) {
+    if (!_hasReportedSharedFrameOverflow) {
+      LOGERR("Warning, frame with size: [%d, %d] does not fit in the "
+             "shared frame ring. Frame export is skipped", viewport.w,
+             viewport.h);
+      _hasReportedSharedFrameOverflow = true;
+    }
+    return;
+  }
 
-    case RendererCmd::UPDATE_RENDERER_TARGET:
-      updateRendererTarget_RT();
-      break;
+  // read back straight into the ring slot - the consumers map it in place
+  constexpr int32_t bytesPerPixel = 4;
+  if (EXIT_SUCCESS != SDL_RenderReadPixels(_sdlRenderer, nullptr,
+          SDL_PIXELFORMAT_ARGB8888, pixels, viewport.w * bytesPerPixel)) {
+    LOGERR("SDL_RenderReadPixels() failed: %s", SDL_GetError());
+    _sharedFrameWriter.abortFrame();
+    return;
+  }
 
-    case RendererCmd::CHANGE_TEXTURE_BLENDMODE:
-      changeTextureBlending_RT();
-      break;
+  _sharedFrameWriter.publishFrame();
+}
 
-    case RendererCmd::CHANGE_TEXTURE_OPACITY:
-      changeTextureOpacity_RT();
-      break;
+void Renderer::enableDisableMultithreadTextureLoading_RT() {
+  /** The ResourceContainer owns the strategy. Every texture loading
+   * command carries the SurfaceLoadBatch of its worker threads
+   * (nullptr if the renderer thread should load the surfaces by itself),
+   * so the payload is only consumed.
+   * */
+  readRendererCmdPayload_RT<EnableDisableMultithreadTextureLoadingPayload>();
+}
 
-    case RendererCmd::CREATE_TTF_TEXT:
-      createTTFText_RT(false);
-      break;
+void Renderer::applyGlobalOffsets_RT(const uint32_t widgetsSize) {
+  RendererState &state = _rendererState[_renderStateIdx];
 
-    case RendererCmd::RELOAD_TTF_TEXT:
-      createTTFText_RT(true);
-      break;
+  // the quads are already resolved, so the crop does not need special care
+  state.widgets.applyGlobalOffset(widgetsSize, state.globalOffsetX,
+                                  state.globalOffsetY);
+}
+
+void Renderer::getRendererProfile_UT(RendererProfile &outProfile) const {
+  if (nullptr == _profiler) {
+    outProfile = RendererProfile();
+    return;
+  }
+
+  _profiler->getSnapshot_UT(outProfile);
+}
 
-    case RendererCmd::DESTROY_TTF_TEXT:
-      destroyTTFText_RT();
-      break;
+bool Renderer::tryReplacePendingFrame_UT() {
+  if (_frameHandoff.hasFreeSlot_UT()) {
+    return false; // nothing to wait for
+  }
+
+  // frames with persistent side effects must always be executed
+  const uint32_t pendingIdx = _frameHandoff.getNewestPublishedSlot_UT();
+  if (_rendererState[pendingIdx].hasPersistentCmds) {
+    return false;
+  }
 
-    case RendererCmd::TAKE_SCREENSHOT:
-      takeScreenshot_RT();
-      break;
+  return _frameHandoff.replacePendingFrame_UT();
+}
+
+bool Renderer::executeRenderCommandsInternal() {
+  const RendererState &state = _rendererState[_renderStateIdx];
+  const uint32_t commandCounter = state.currRendererCmdsCounter;
 
-    case RendererCmd::ENABLE_DISABLE_MULTITHREAD_TEXTURE_LOADING:
-      enableDisableMultithreadTextureLoading_RT();
-      break;
+#if ENABLE_RENDERER_PROFILING
+  const uint64_t frameStartNs = RendererProfiler::nowNs();
+  uint64_t cmdStartNs = frameStartNs;
+#endif /* ENABLE_RENDERER_PROFILING */
 
-    case RendererCmd::EXIT_RENDERING_LOOP:
-      _isShutdowned = true;
-      _isRendererBusy = false;
-      // wake the update thread that is sleeping on the condition variable
-      _renderCondVar.notify_one();
+  for (uint32_t idx = 0; idx < commandCounter; ++idx) {
+    const RendererCmd rendererCmd = state.rendererCmd[idx];
+    if (RendererCmd::EXIT_RENDERING_LOOP == rendererCmd) {
+      // wake the update thread (if it's waiting for a free renderer state)
+      _frameHandoff.shutdown_RT();
       return true;
+    }
+
+    // anything else could change the texture content or the clear color
+    if ((RendererCmd::CLEAR_SCREEN != rendererCmd) &&
+        (RendererCmd::FINISH_FRAME != rendererCmd)) {
+      _frameHasStateChanges = true;
+    }
 
-    default:
-      LOGERR("Error, received unknown RendererOp: %hhu at index: %u",
-          getEnumValue(state.rendererCmd[idx]), idx);
-      break;
+    // the static layers could hold the old content of the textures
+    if ((RendererCmd::LOAD_TEXTURE_SINGLE == rendererCmd) ||
+        (RendererCmd::LOAD_TEXTURE_MULTIPLE == rendererCmd) ||
+        (RendererCmd::DESTROY_TEXTURE == rendererCmd) ||
+        (RendererCmd::CHANGE_TEXTURE_BLENDMODE == rendererCmd)) {
+      _hasImageTextureChanges = true;
     }
+
+    const uint32_t cmdIdx = getEnumValue(rendererCmd);
+    if ((RENDERER_CMDS_COUNT > cmdIdx) && (nullptr != CMD_HANDLERS[cmdIdx])) {
+      (this->*CMD_HANDLERS[cmdIdx])();
+    } else {
+      LOGERR("Error, received unknown RendererOp: %u at index: %u",
+          cmdIdx, idx);
+    }
+
+#if ENABLE_RENDERER_PROFILING
+    const uint64_t cmdEndNs = RendererProfiler::nowNs();
+    _profiler->recordCmd_RT(rendererCmd, cmdEndNs - cmdStartNs);
+    cmdStartNs = cmdEndNs;
+#endif /* ENABLE_RENDERER_PROFILING */
   }
 
+#if ENABLE_RENDERER_PROFILING
+  _profiler->recordFrame_RT(commandCounter, cmdStartNs - frameStartNs);
+#endif /* ENABLE_RENDERER_PROFILING */
+
   // all renderer commands were executed -> zero out the counter
   _rendererState[_renderStateIdx].currRendererCmdsCounter = 0;
 
-  // manually unlock render mutex -> and let the update thread swap buffers
-  //(if its ready with it)
-  _isRendererBusy = false;
+  // unread data would corrupt the next frame executed on this state
+  RenderDataBuffer &renderData = _rendererState[_renderStateIdx].renderData;
+  if (0 != renderData.size()) {
+    LOGERR("Warning, %" PRIu64" bytes of renderer data were not consumed "
+           "by the executed commands", renderData.size());
+    renderData.clear();
+  }
+
+  // the frame could consist only of resource commands (no FINISH_FRAME)
+  _rendererState[_renderStateIdx].frameArena.reset();
+  _rendererState[_renderStateIdx].isReplayedFrame = false;
 
   return false;
 }
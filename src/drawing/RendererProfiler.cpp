@@ -0,0 +1,111 @@
+// Corresponding header
+#include "sdl_utils/drawing/RendererProfiler.h"
+
+// System headers
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
+// Other libraries headers
+#include "utils/data_type/EnumClassUtils.h"
+
+// Own components headers
+
+uint32_t RendererTimingHistogram::getBucketIdx(const uint64_t durationNs) {
+  // the first power of 2 ranges are smaller than the sub-bucket count
+  if (durationNs < SUB_BUCKETS_COUNT) {
+    return static_cast<uint32_t>(durationNs);
+  }
+
+  const uint32_t msb = static_cast<uint32_t>(std::bit_width(durationNs)) - 1;
+  if (msb >= MAX_DURATION_BITS) {
+    return BUCKETS_COUNT - 1;
+  }
+
+  const uint32_t shift = msb - SUB_BUCKET_BITS;
+  const uint32_t subBucket =
+      static_cast<uint32_t>(durationNs >> shift) & (SUB_BUCKETS_COUNT - 1);
+  return ((shift + 1) * SUB_BUCKETS_COUNT) + subBucket;
+}
+
+uint64_t RendererTimingHistogram::getBucketLowerBoundNs(
+    const uint32_t bucketIdx) {
+  if (bucketIdx < SUB_BUCKETS_COUNT) {
+    return bucketIdx;
+  }
+
+  const uint32_t shift = (bucketIdx / SUB_BUCKETS_COUNT) - 1;
+  const uint64_t subBucket = bucketIdx % SUB_BUCKETS_COUNT;
+  return (SUB_BUCKETS_COUNT + subBucket) << shift;
+}
+
+uint64_t RendererTimingHistogram::getPercentileNs(
+    const double percentile) const {
+  uint64_t totalCount = 0;
+  for (const uint64_t bucket : buckets) {
+    totalCount += bucket;
+  }
+  if (0 == totalCount) {
+    return 0;
+  }
+
+  const double clampedPercentile = std::clamp(percentile, 0.0, 100.0);
+  const uint64_t targetCount = std::max<uint64_t>(1,
+      static_cast<uint64_t>((clampedPercentile / 100.0) * totalCount));
+
+  uint64_t accumulatedCount = 0;
+  for (uint32_t i = 0; i < BUCKETS_COUNT; ++i) {
+    accumulatedCount += buckets[i];
+    if (accumulatedCount >= targetCount) {
+      return getBucketLowerBoundNs(i);
+    }
+  }
+
+  return getBucketLowerBoundNs(BUCKETS_COUNT - 1);
+}
+
+uint64_t RendererProfiler::nowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void RendererProfiler::recordCmd_RT(const RendererCmd cmd,
+                                    const uint64_t durationNs) {
+  const auto cmdIdx = getEnumValue(cmd);
+  if (RENDERER_CMDS_COUNT <= cmdIdx) {
+    return;
+  }
+
+  RendererCmdProfile &profile = _accumulated.cmds[cmdIdx];
+  ++profile.count;
+  profile.totalNs += durationNs;
+  profile.maxNs = std::max(profile.maxNs, durationNs);
+  profile.histogram.record(durationNs);
+}
+
+void RendererProfiler::recordFrame_RT(const uint32_t cmdsCount,
+                                      const uint64_t durationNs) {
+  ++_accumulated.frames;
+  _accumulated.lastFrameNs = durationNs;
+  _accumulated.lastFrameCmds = cmdsCount;
+  _accumulated.maxFrameNs = std::max(_accumulated.maxFrameNs, durationNs);
+  _accumulated.frameHistogram.record(durationNs);
+  _accumulated.isEnabled = true;
+
+  // publish the back buffer and take ownership of the previous middle one
+  _buffers[_backIdx] = _accumulated;
+  const uint8_t prevMiddle =
+      _middle.exchange(_backIdx | HAS_NEW_DATA, std::memory_order_acq_rel);
+  _backIdx = prevMiddle & BUFFER_IDX_MASK;
+}
+
+void RendererProfiler::getSnapshot_UT(RendererProfile &outProfile) const {
+  if (HAS_NEW_DATA & _middle.load(std::memory_order_relaxed)) {
+    const uint8_t prevMiddle =
+        _middle.exchange(_frontIdx, std::memory_order_acq_rel);
+    _frontIdx = prevMiddle & BUFFER_IDX_MASK;
+  }
+
+  outProfile = _buffers[_frontIdx];
+}
@@ -16,11 +16,47 @@ ErrorCode RendererState::init(const RendererConfig &cfg) {
     return ErrorCode::FAILURE;
   }
 
+  // the transient allocations hold data, extracted from the renderData
+  if (ErrorCode::SUCCESS !=
+      frameArena.init(cfg.maxRendererBackBufferDataSize)) {
+    LOGERR("frameArena.init() failed");
+    return ErrorCode::FAILURE;
+  }
+
   maxRuntimeRendererCmds = cfg.maxRuntimeRendererCommands;
   rendererCmd.resize(cfg.maxRuntimeRendererCommands, RendererCmd::UNDEFINED);
 
   maxRuntimeWidgets = cfg.maxRuntimeWidgets;
-  widgets.resize(cfg.maxRuntimeWidgets);
+  if (ErrorCode::SUCCESS != widgets.init(cfg.maxRuntimeWidgets)) {
+    LOGERR("widgets.init() failed");
+    return ErrorCode::FAILURE;
+  }
 
   return ErrorCode::SUCCESS;
 }
+
+void RendererState::growWidgets(const uint32_t capacity) {
+  if (capacity <= maxRuntimeWidgets) {
+    return;
+  }
+
+  widgets.resize(capacity);
+  maxRuntimeWidgets = capacity;
+}
+
+void RendererState::growRendererCmds(const uint32_t capacity) {
+  if (capacity <= maxRuntimeRendererCmds) {
+    return;
+  }
+
+  rendererCmd.resize(capacity, RendererCmd::UNDEFINED);
+  maxRuntimeRendererCmds = capacity;
+}
+
+void RendererState::discardFrame() {
+  currWidgetCounter = 0;
+  currRendererCmdsCounter = 0;
+  renderData.clear();
+  hasPersistentCmds = false;
+  isReplayedFrame = false;
+}
@@ -0,0 +1,226 @@
+// Corresponding header
+#include "sdl_utils/drawing/ScreenshotEncoder.h"
+
+// System headers
+#include <cinttypes>
+#include <cstdlib>
+
+// Other libraries headers
+#include <SDL_image.h>
+#include <SDL_pixels.h>
+#include <SDL_surface.h>
+#include "utils/time/Time.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+
+ScreenshotEncoder::~ScreenshotEncoder() {
+  deinit();
+}
+
+ErrorCode ScreenshotEncoder::init(const uint32_t threadsCount,
+                                  const uint32_t maxPendingScreenshots) {
+  if (0 == threadsCount) {
+    LOGERR("Error, threadsCount can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 == maxPendingScreenshots) {
+    LOGERR("Error, maxPendingScreenshots can not be 0");
+    return ErrorCode::FAILURE;
+  }
+  _maxPendingScreenshots = maxPendingScreenshots;
+
+  _isShutdown = false;
+  _workers.reserve(threadsCount);
+  for (uint32_t i = 0; i < threadsCount; ++i) {
+    _workers.emplace_back(&ScreenshotEncoder::workerLoop, this);
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void ScreenshotEncoder::deinit() {
+  {
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    _isShutdown = true;
+  }
+  _jobsCv.notify_all();
+
+  // the workers leave only after the pending screenshots are written
+  for (std::thread &worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+
+  std::lock_guard<std::mutex> lock(_buffersMutex);
+  _freeBuffers.clear();
+}
+
+uint64_t ScreenshotEncoder::registerScreenshot(
+    const ScreenshotCompletionCb &completionCb) {
+  std::lock_guard<std::mutex> lock(_callbacksMutex);
+  const uint64_t screenshotId = _nextScreenshotId++;
+  if (completionCb) {
+    _completionCbs.emplace(screenshotId, completionCb);
+  }
+
+  return screenshotId;
+}
+
+bool ScreenshotEncoder::tryAcquireBuffer(const uint64_t bytes,
+                                         std::vector<uint8_t> &outBuffer) {
+  std::lock_guard<std::mutex> lock(_buffersMutex);
+  if (_buffersInFlight >= _maxPendingScreenshots) {
+    ++_droppedScreenshots;
+    return false;
+  }
+  ++_buffersInFlight;
+
+  if (!_freeBuffers.empty()) {
+    outBuffer = std::move(_freeBuffers.back());
+    _freeBuffers.pop_back();
+  }
+  outBuffer.resize(bytes);
+
+  return true;
+}
+
+void ScreenshotEncoder::submit(ScreenshotJob &&job) {
+  {
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    _jobs.push_back(std::move(job));
+  }
+  _jobsCv.notify_one();
+}
+
+void ScreenshotEncoder::cancel(const uint64_t screenshotId, const char *file,
+                               std::vector<uint8_t> &buffer) {
+  if (!buffer.empty()) {
+    releaseBuffer(buffer);
+  }
+
+  // the callback is invoked from an encoder thread, as for the
+  // written screenshots
+  ScreenshotJob job;
+  job.file = file;
+  job.screenshotId = screenshotId;
+  job.isCancelled = true;
+  submit(std::move(job));
+}
+
+void ScreenshotEncoder::drop(const uint64_t screenshotId, const char *file) {
+  {
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    ++_droppedScreenshots;
+  }
+
+  std::vector<uint8_t> noBuffer;
+  cancel(screenshotId, file, noBuffer);
+}
+
+uint64_t ScreenshotEncoder::getDroppedScreenshotsCount() const {
+  std::lock_guard<std::mutex> lock(_buffersMutex);
+  return _droppedScreenshots;
+}
+
+void ScreenshotEncoder::workerLoop() {
+  ScreenshotJob job;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_jobsMutex);
+      _jobsCv.wait(lock, [this]() {
+        return _isShutdown || !_jobs.empty();
+      });
+
+      if (_jobs.empty()) {
+        return; // shutdown and nothing left to write
+      }
+
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+
+    if (job.isCancelled) {
+      complete(job.screenshotId, job.file.c_str(), ErrorCode::FAILURE);
+      continue;
+    }
+
+    const ErrorCode err = encode(job);
+    if (ErrorCode::SUCCESS != err) {
+      LOGERR("Error, screenshot could not be written to file: [%s]",
+             job.file.c_str());
+    }
+
+    releaseBuffer(job.pixels);
+    complete(job.screenshotId, job.file.c_str(), err);
+  }
+}
+
+ErrorCode ScreenshotEncoder::encode(const ScreenshotJob &job) {
+  Time time;
+
+  constexpr int32_t depth = 32;
+  constexpr int32_t bytesPerPixel = 4;
+  SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormatFrom(
+      const_cast<uint8_t*>(job.pixels.data()), job.width, job.height, depth,
+      job.width * bytesPerPixel, SDL_PIXELFORMAT_ARGB8888);
+  if (nullptr == surface) {
+    LOGERR("SDL_CreateRGBSurfaceWithFormatFrom() failed: %s",
+           SDL_GetError());
+    return ErrorCode::FAILURE;
+  }
+
+  ErrorCode err = ErrorCode::SUCCESS;
+  if (ScreenshotContainer::PNG == job.container) {
+    if (EXIT_SUCCESS != IMG_SavePNG(surface, job.file.c_str())) {
+      LOGERR("IMG_SavePNG() failed: %s", SDL_GetError());
+      err = ErrorCode::FAILURE;
+    }
+  } else { //JPG
+#if defined(__EMSCRIPTEN__)
+    LOGY("IMG_SaveJPG() not supported on Emscripten. "
+         "Will not save file [%s]", job.file.c_str());
+    err = ErrorCode::FAILURE;
+#else
+    if (EXIT_SUCCESS != IMG_SaveJPG(surface, job.file.c_str(), job.quality)) {
+      LOGERR("IMG_SaveJPG() failed: %s", SDL_GetError());
+      err = ErrorCode::FAILURE;
+    }
+#endif
+  }
+
+  // the pixels are owned by the job
+  SDL_FreeSurface(surface);
+
+  if (ErrorCode::SUCCESS == err) {
+    const uint64_t timeMs =
+        static_cast<uint64_t>(time.getElapsed().toMilliseconds());
+    LOG("Screenshot [%s] took [%" PRIu64" ms] to encode and store",
+        job.file.c_str(), timeMs);
+  }
+  return err;
+}
+
+void ScreenshotEncoder::complete(const uint64_t screenshotId,
+                                 const char *file, const ErrorCode err) {
+  ScreenshotCompletionCb completionCb;
+  {
+    std::lock_guard<std::mutex> lock(_callbacksMutex);
+    const auto it = _completionCbs.find(screenshotId);
+    if (_completionCbs.end() == it) {
+      return;
+    }
+    completionCb = std::move(it->second);
+    _completionCbs.erase(it);
+  }
+
+  completionCb(file, err);
+}
+
+void ScreenshotEncoder::releaseBuffer(std::vector<uint8_t> &buffer) {
+  std::lock_guard<std::mutex> lock(_buffersMutex);
+  _freeBuffers.push_back(std::move(buffer));
+  buffer = std::vector<uint8_t>();
+  --_buffersInFlight;
+}
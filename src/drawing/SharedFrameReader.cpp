@@ -0,0 +1,142 @@
+// Corresponding header
+#include "sdl_utils/drawing/SharedFrameReader.h"
+
+// System headers
+#if SHARED_FRAME_EXPORT_SUPPORTED
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+SharedFrameReader::~SharedFrameReader() noexcept {
+  close();
+}
+
+ErrorCode SharedFrameReader::open(const std::string &name) {
+#if SHARED_FRAME_EXPORT_SUPPORTED
+  if (nullptr != _header) {
+    LOGERR("Error, SharedFrameReader is already open");
+    return ErrorCode::FAILURE;
+  }
+
+  // read-write, because the consumer counters live in the ring header
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (-1 == fd) {
+    LOGERR("Error, shm_open() failed for [%s]", name.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  struct stat objectStat;
+  if ((0 != fstat(fd, &objectStat)) ||
+      (static_cast<uint64_t>(objectStat.st_size) <
+       sizeof(SharedFrameRingHeader))) {
+    LOGERR("Error, [%s] is not a shared frame ring", name.c_str());
+    ::close(fd);
+    return ErrorCode::FAILURE;
+  }
+
+  const uint64_t memoryBytes = static_cast<uint64_t>(objectStat.st_size);
+  void *memory = mmap(nullptr, memoryBytes, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (MAP_FAILED == memory) {
+    LOGERR("Error, mmap() failed for [%s]", name.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  auto header = static_cast<SharedFrameRingHeader*>(memory);
+  const uint32_t magic = header->magic;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if ((SHARED_FRAME_MAGIC != magic) ||
+      (SHARED_FRAME_VERSION != header->version) ||
+      (memoryBytes < sizeof(SharedFrameRingHeader) +
+                     (header->slotsCount * header->slotStride))) {
+    LOGERR("Error, [%s] is not initialised or has unsupported version: %u "
+           "(supported: %u)", name.c_str(), header->version,
+           SHARED_FRAME_VERSION);
+    munmap(memory, memoryBytes);
+    return ErrorCode::FAILURE;
+  }
+
+  _memory = static_cast<uint8_t*>(memory);
+  _memoryBytes = memoryBytes;
+  _header = header;
+
+  heartbeat();
+  _header->consumersCount.fetch_add(1, std::memory_order_acq_rel);
+
+  return ErrorCode::SUCCESS;
+#else
+  LOGERR("Error, shared frame ring [%s] is not supported on this platform",
+         name.c_str());
+  return ErrorCode::FAILURE;
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+}
+
+void SharedFrameReader::close() {
+#if SHARED_FRAME_EXPORT_SUPPORTED
+  if (nullptr == _header) {
+    return;
+  }
+
+  _header->consumersCount.fetch_sub(1, std::memory_order_acq_rel);
+  munmap(_memory, _memoryBytes);
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+
+  _memory = nullptr;
+  _memoryBytes = 0;
+  _header = nullptr;
+}
+
+bool SharedFrameReader::acquireLatestFrame(SharedFrameView &outView) {
+  heartbeat();
+
+  const uint64_t frameSequence =
+      _header->latestSequence.load(std::memory_order_acquire);
+  if (0 == frameSequence) {
+    return false;
+  }
+
+  const SharedFrameSlotHeader *slot =
+      getSharedFrameSlot(_memory, *_header, frameSequence);
+  const uint64_t lockSequence =
+      slot->lockSequence.load(std::memory_order_acquire);
+  // the slot is being written or already holds a newer frame
+  if ((2 * frameSequence) != lockSequence) {
+    return false;
+  }
+
+  outView.frameSequence = slot->frameSequence;
+  outView.timestampNs = slot->timestampNs;
+  outView.width = slot->width;
+  outView.height = slot->height;
+  outView.pitch = slot->pitch;
+  outView.pixels =
+      reinterpret_cast<const uint8_t*>(slot) + sizeof(SharedFrameSlotHeader);
+  outView.slot = slot;
+  outView.lockSequence = lockSequence;
+
+  // the frame description should be consistent as well
+  return isValid(outView);
+}
+
+bool SharedFrameReader::isValid(const SharedFrameView &view) const {
+  if (nullptr == view.slot) {
+    return false;
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return view.lockSequence ==
+         view.slot->lockSequence.load(std::memory_order_relaxed);
+}
+
+void SharedFrameReader::heartbeat() {
+  _header->consumerHeartbeatNs.store(getSharedFrameClockNs(),
+                                     std::memory_order_relaxed);
+}
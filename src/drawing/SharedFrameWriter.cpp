@@ -0,0 +1,236 @@
+// Corresponding header
+#include "sdl_utils/drawing/SharedFrameWriter.h"
+
+// System headers
+#include <cinttypes>
+#include <new>
+#if SHARED_FRAME_EXPORT_SUPPORTED
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+#if SHARED_FRAME_EXPORT_SUPPORTED
+namespace {
+bool isProcessAlive(const int32_t pid) {
+  if (0 >= pid) {
+    return false;
+  }
+
+  // EPERM - the process exists, but belongs to another user
+  return (0 == kill(static_cast<pid_t>(pid), 0)) || (EPERM == errno);
+}
+
+/** @brief checks whether an existing ring is left by a writer, which
+ *         is no longer running (or has an incompatible layout)
+ * */
+bool isStaleRing(const std::string &name) {
+  const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (-1 == fd) {
+    // removed in the meantime
+    return ENOENT == errno;
+  }
+
+  struct stat memoryStat {};
+  if ((0 != fstat(fd, &memoryStat)) ||
+      (static_cast<uint64_t>(memoryStat.st_size) <
+          sizeof(SharedFrameRingHeader))) {
+    ::close(fd);
+    return true;
+  }
+
+  void *memory = mmap(nullptr, sizeof(SharedFrameRingHeader), PROT_READ,
+                      MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (MAP_FAILED == memory) {
+    return false;
+  }
+
+  const auto *header = static_cast<const SharedFrameRingHeader*>(memory);
+  const bool isStale = (SHARED_FRAME_MAGIC != header->magic) ||
+                       (SHARED_FRAME_VERSION != header->version) ||
+                       !isProcessAlive(header->writerPid);
+  munmap(memory, sizeof(SharedFrameRingHeader));
+
+  return isStale;
+}
+}
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+
+SharedFrameWriter::~SharedFrameWriter() noexcept {
+  close();
+}
+
+ErrorCode SharedFrameWriter::open(const std::string &name,
+                                  const uint32_t slotsCount,
+                                  const int32_t maxWidth,
+                                  const int32_t maxHeight) {
+#if SHARED_FRAME_EXPORT_SUPPORTED
+  if (isOpen()) {
+    LOGERR("Error, shared frame ring [%s] is already open", _name.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  // with a single slot every frame would overwrite the one being read
+  if (2 > slotsCount) {
+    LOGERR("Error, slotsCount: %u can not be less than 2", slotsCount);
+    return ErrorCode::FAILURE;
+  }
+
+  if ((0 >= maxWidth) || (0 >= maxHeight)) {
+    LOGERR("Error, invalid max frame size: [%d, %d]", maxWidth, maxHeight);
+    return ErrorCode::FAILURE;
+  }
+
+  constexpr uint64_t bytesPerPixel = 4;
+  const uint64_t pixelsCapacity = static_cast<uint64_t>(maxWidth) *
+                                  static_cast<uint64_t>(maxHeight) *
+                                  bytesPerPixel;
+  const uint64_t slotStride = ((sizeof(SharedFrameSlotHeader) +
+      pixelsCapacity + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) *
+      CACHE_LINE_SIZE;
+  const uint64_t memoryBytes =
+      sizeof(SharedFrameRingHeader) + (slotsCount * slotStride);
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if ((-1 == fd) && (EEXIST == errno)) {
+    if (!isStaleRing(name)) {
+      LOGERR("Error, shared frame ring [%s] is owned by another running "
+             "writer. Use a different sharedFrameExportName", name.c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    // the previous writer crashed without removing it
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  }
+  if (-1 == fd) {
+    LOGERR("Error, shm_open() failed for [%s]", name.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 != ftruncate(fd, static_cast<off_t>(memoryBytes))) {
+    LOGERR("Error, ftruncate() failed for [%s] with size: %" PRIu64,
+           name.c_str(), memoryBytes);
+    ::close(fd);
+    shm_unlink(name.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  void *memory = mmap(nullptr, memoryBytes, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (MAP_FAILED == memory) {
+    LOGERR("Error, mmap() failed for [%s]", name.c_str());
+    shm_unlink(name.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  _name = name;
+  _memory = static_cast<uint8_t*>(memory);
+  _memoryBytes = memoryBytes;
+  _frameSequence = 0;
+
+  _header = new (_memory) SharedFrameRingHeader();
+  _header->magic = 0;
+  _header->slotsCount = slotsCount;
+  _header->maxWidth = maxWidth;
+  _header->maxHeight = maxHeight;
+  _header->slotPixelsCapacity = pixelsCapacity;
+  _header->slotStride = slotStride;
+  _header->writerPid = static_cast<int32_t>(getpid());
+  for (uint32_t i = 0; i < slotsCount; ++i) {
+    new (getSharedFrameSlot(_memory, *_header, i)) SharedFrameSlotHeader();
+  }
+
+  // the readers validate the magic, so it is written last
+  std::atomic_thread_fence(std::memory_order_release);
+  _header->magic = SHARED_FRAME_MAGIC;
+
+  return ErrorCode::SUCCESS;
+#else
+  LOGERR("Error, shared frame export to [%s] with slotsCount: %u and max "
+         "size: [%d, %d] is not supported on this platform", name.c_str(),
+         slotsCount, maxWidth, maxHeight);
+  return ErrorCode::FAILURE;
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+}
+
+void SharedFrameWriter::close() {
+#if SHARED_FRAME_EXPORT_SUPPORTED
+  if (!isOpen()) {
+    return;
+  }
+
+  munmap(_memory, _memoryBytes);
+  shm_unlink(_name.c_str());
+#endif /* SHARED_FRAME_EXPORT_SUPPORTED */
+
+  _memory = nullptr;
+  _memoryBytes = 0;
+  _header = nullptr;
+  _writtenSlot = nullptr;
+}
+
+bool SharedFrameWriter::hasConsumers() const {
+  if (0 == _header->consumersCount.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  // the consumer could have crashed without detaching
+  const int64_t heartbeatNs =
+      _header->consumerHeartbeatNs.load(std::memory_order_relaxed);
+  return (getSharedFrameClockNs() - heartbeatNs) <
+         SHARED_FRAME_CONSUMER_TIMEOUT_NS;
+}
+
+uint8_t *SharedFrameWriter::beginFrame(const int32_t width,
+                                       const int32_t height) {
+  if ((width > _header->maxWidth) || (height > _header->maxHeight)) {
+    return nullptr;
+  }
+
+  _writtenSlot = getSlot(_frameSequence + 1);
+
+  // odd sequence - the slot is being written
+  _writtenSlot->lockSequence.store((2 * (_frameSequence + 1)) - 1,
+                                   std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  constexpr int32_t bytesPerPixel = 4;
+  _writtenSlot->frameSequence = _frameSequence + 1;
+  _writtenSlot->timestampNs = getSharedFrameClockNs();
+  _writtenSlot->width = width;
+  _writtenSlot->height = height;
+  _writtenSlot->pitch = width * bytesPerPixel;
+
+  return reinterpret_cast<uint8_t*>(_writtenSlot) +
+         sizeof(SharedFrameSlotHeader);
+}
+
+void SharedFrameWriter::publishFrame() {
+  ++_frameSequence;
+  _writtenSlot->lockSequence.store(2 * _frameSequence,
+                                   std::memory_order_release);
+  _header->latestSequence.store(_frameSequence, std::memory_order_release);
+  _writtenSlot = nullptr;
+}
+
+void SharedFrameWriter::abortFrame() {
+  // the previous frame of the slot is partially overwritten, so the slot
+  // stays locked (odd sequence) until the next frame is published in it
+  _writtenSlot = nullptr;
+}
+
+SharedFrameSlotHeader *SharedFrameWriter::getSlot(
+    const uint64_t frameSequence) const {
+  return getSharedFrameSlot(_memory, *_header, frameSequence);
+}
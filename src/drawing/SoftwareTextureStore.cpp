@@ -0,0 +1,80 @@
+// Corresponding header
+#include "sdl_utils/drawing/SoftwareTextureStore.h"
+
+// System headers
+#include <cstdlib>
+
+// Other libraries headers
+#include <SDL_pixels.h>
+#include <SDL_render.h>
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/Texture.h"
+
+const SoftwareTexture *SoftwareTextureStore::acquire(SDL_Texture *texture) {
+  const auto it = _textures.find(texture);
+  if (_textures.end() != it) {
+    return &it->second;
+  }
+
+  SoftwareTexture softwareTexture;
+  if (ErrorCode::SUCCESS != readTexture(texture, softwareTexture)) {
+    LOGERR("Error, readTexture() failed");
+    return nullptr;
+  }
+
+  return &(_textures[texture] = std::move(softwareTexture));
+}
+
+ErrorCode SoftwareTextureStore::readTexture(SDL_Texture *texture,
+                                            SoftwareTexture &outTexture) {
+  int32_t width = 0;
+  int32_t height = 0;
+  SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+  uint8_t alphaMod = 0;
+  if ((EXIT_SUCCESS != SDL_QueryTexture(texture, nullptr, nullptr, &width,
+                                        &height)) ||
+      (EXIT_SUCCESS != SDL_GetTextureBlendMode(texture, &blendMode)) ||
+      (EXIT_SUCCESS != SDL_GetTextureAlphaMod(texture, &alphaMod))) {
+    LOGERR("Error, texture could not be queried. SDL Error: %s",
+           SDL_GetError());
+    return ErrorCode::FAILURE;
+  }
+
+  // only non-streaming textures could be read back, so copy the
+  // texture into a render target with it's raw content
+  SDL_Texture *readTarget = nullptr;
+  if (ErrorCode::SUCCESS !=
+      Texture::createEmptyTexture(width, height, readTarget)) {
+    LOGERR("Texture::createEmptyTexture() failed");
+    return ErrorCode::FAILURE;
+  }
+
+  ErrorCode err = Texture::setRendererTarget(readTarget);
+  if (ErrorCode::SUCCESS == err) {
+    // the modulation is restored right after the copy, so the
+    // Texture state cache stays valid
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    SDL_SetTextureAlphaMod(texture, FULL_OPACITY);
+
+    outTexture.width = width;
+    outTexture.height = height;
+    outTexture.pixels.resize(static_cast<size_t>(width) * height);
+    if ((EXIT_SUCCESS != SDL_RenderCopy(_renderer, texture, nullptr,
+                                        nullptr)) ||
+        (EXIT_SUCCESS != SDL_RenderReadPixels(_renderer, nullptr,
+            SDL_PIXELFORMAT_ARGB8888, outTexture.pixels.data(),
+            width * static_cast<int32_t>(sizeof(uint32_t))))) {
+      LOGERR("Error, texture could not be read back. SDL Error: %s",
+             SDL_GetError());
+      err = ErrorCode::FAILURE;
+    }
+
+    SDL_SetTextureBlendMode(texture, blendMode);
+    SDL_SetTextureAlphaMod(texture, alphaMod);
+  }
+
+  Texture::freeTexture(readTarget);
+  return err;
+}
@@ -0,0 +1,307 @@
+// Corresponding header
+#include "sdl_utils/drawing/StaticLayerCache.h"
+
+// System headers
+#include <cstdlib>
+
+// Other libraries headers
+#include <SDL_pixels.h>
+#include <SDL_render.h>
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/DrawParams.h"
+#include "sdl_utils/drawing/FrameWidgets.h"
+#include "sdl_utils/drawing/Texture.h"
+
+namespace {
+// the layer FBO holds colors, already multiplied by their alpha
+SDL_BlendMode getPremultipliedBlendMode() {
+  return SDL_ComposeCustomBlendMode(
+      SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+      SDL_BLENDOPERATION_ADD,
+      SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+      SDL_BLENDOPERATION_ADD);
+}
+}
+
+ErrorCode StaticLayerCache::init(const uint32_t maxWidgets,
+                                 const uint32_t stableFrames,
+                                 const uint32_t minLayerWidgets) {
+  if (0 == maxWidgets) {
+    LOGERR("Error, maxWidgets can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 == stableFrames) {
+    LOGERR("Error, stableFrames can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  // a single widget layer does not save any draw calls
+  if (2 > minLayerWidgets) {
+    LOGERR("Error, minLayerWidgets: %u can not be less than 2",
+           minLayerWidgets);
+    return ErrorCode::FAILURE;
+  }
+
+  _stableFrames = stableFrames;
+  _minLayerWidgets = minLayerWidgets;
+  resize(maxWidgets);
+
+  return ErrorCode::SUCCESS;
+}
+
+void StaticLayerCache::deinit() {
+  for (StaticLayer &layer : _layers) {
+    Texture::freeTexture(layer.texture);
+    layer = StaticLayer();
+  }
+}
+
+void StaticLayerCache::update(const FrameWidgets &widgets,
+                              const uint32_t size) {
+  if (!_isSupported) {
+    return;
+  }
+
+  // the frame could be bigger than the initial capacity
+  if (size > _rowHashes.size()) {
+    resize(size);
+  }
+
+  for (uint32_t i = 0; i < size; ++i) {
+    const uint64_t rowHash = widgets.computeRowHash(i);
+    if ((i < _prevSize) && (rowHash == _rowHashes[i])) {
+      if (_unchangedFrames[i] < _stableFrames) {
+        ++_unchangedFrames[i];
+      }
+      continue;
+    }
+
+    _rowHashes[i] = rowHash;
+    _unchangedFrames[i] = 0;
+    _isRejected[i] = 0;
+  }
+  _prevSize = size;
+
+  // a single changed widget invalidates the whole layer
+  for (StaticLayer &layer : _layers) {
+    if (!layer.isValid) {
+      continue;
+    }
+
+    const uint32_t endIdx = layer.startIdx + layer.widgetsCount;
+    if (endIdx > size) {
+      layer.isValid = false;
+      continue;
+    }
+
+    for (uint32_t i = layer.startIdx; i < endIdx; ++i) {
+      if (0 == _unchangedFrames[i]) {
+        layer.isValid = false;
+        break;
+      }
+    }
+  }
+
+  const auto isRowCovered = [this](const uint32_t idx) {
+    for (const StaticLayer &layer : _layers) {
+      if (layer.isValid && (idx >= layer.startIdx) &&
+          (idx < layer.startIdx + layer.widgetsCount)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // create layers for the long enough runs of stable widgets
+  uint32_t runStartIdx = 0;
+  uint32_t runSize = 0;
+  for (uint32_t i = 0; i <= size; ++i) {
+    if ((i < size) && isRowCacheable(widgets, i) && !isRowCovered(i)) {
+      if (0 == runSize) {
+        runStartIdx = i;
+      }
+      ++runSize;
+      continue;
+    }
+
+    if (runSize >= _minLayerWidgets) {
+      StaticLayer *freeLayer = nullptr;
+      for (StaticLayer &layer : _layers) {
+        if (!layer.isValid) {
+          freeLayer = &layer;
+          break;
+        }
+      }
+
+      if (nullptr == freeLayer) {
+        return;
+      }
+
+      freeLayer->startIdx = runStartIdx;
+      freeLayer->widgetsCount = runSize;
+      freeLayer->isValid = true;
+      freeLayer->needsRender = true;
+    }
+    runSize = 0;
+  }
+}
+
+void StaticLayerCache::invalidate() {
+  for (StaticLayer &layer : _layers) {
+    layer.isValid = false;
+  }
+
+  // the blend modes could have changed as well
+  for (uint32_t i = 0; i < _prevSize; ++i) {
+    _isRejected[i] = 0;
+  }
+}
+
+SDL_Texture *StaticLayerCache::beginLayerRender(const uint32_t layerIdx,
+                                                const FrameWidgets &widgets,
+                                                const int32_t viewportWidth,
+                                                const int32_t viewportHeight) {
+  StaticLayer &layer = _layers[layerIdx];
+
+  const uint32_t endIdx = layer.startIdx + layer.widgetsCount;
+  for (uint32_t i = layer.startIdx; i < endIdx; ++i) {
+    if (!hasSupportedBlending(widgets, i)) {
+      // the run is split on the next frame
+      _isRejected[i] = 1;
+      layer.isValid = false;
+    }
+  }
+
+  if (!layer.isValid) {
+    return nullptr;
+  }
+
+  // the renderer viewport has changed
+  if ((nullptr != layer.texture) && ((viewportWidth != layer.width) ||
+                                     (viewportHeight != layer.height))) {
+    Texture::freeTexture(layer.texture);
+  }
+
+  if (nullptr == layer.texture) {
+    if (ErrorCode::SUCCESS != Texture::createEmptyTexture(viewportWidth,
+            viewportHeight, layer.texture)) {
+      LOGERR("Texture::createEmptyTexture() failed");
+      layer.isValid = false;
+      return nullptr;
+    }
+    layer.width = viewportWidth;
+    layer.height = viewportHeight;
+
+    if (EXIT_SUCCESS != SDL_SetTextureBlendMode(layer.texture,
+            getPremultipliedBlendMode())) {
+      LOGERR("Warning, premultiplied alpha blending is not supported by the "
+             "renderer. Static layer caching will be disabled. SDL Error: %s",
+             SDL_GetError());
+      _isSupported = false;
+      deinit();
+      return nullptr;
+    }
+  }
+
+  return layer.texture;
+}
+
+void StaticLayerCache::finishLayerRender(const uint32_t layerIdx) {
+  _layers[layerIdx].needsRender = false;
+}
+
+uint32_t StaticLayerCache::substitute(FrameWidgets &widgets,
+                                      const uint32_t size) const {
+  // the rendered layers, ordered by their first row
+  const StaticLayer *drawnLayers[MAX_LAYERS] { };
+  uint32_t drawnLayersCount = 0;
+  for (const StaticLayer &layer : _layers) {
+    if (!layer.isValid || layer.needsRender) {
+      continue;
+    }
+
+    uint32_t pos = drawnLayersCount;
+    while ((0 < pos) && (drawnLayers[pos - 1]->startIdx > layer.startIdx)) {
+      drawnLayers[pos] = drawnLayers[pos - 1];
+      --pos;
+    }
+    drawnLayers[pos] = &layer;
+    ++drawnLayersCount;
+  }
+
+  if (0 == drawnLayersCount) {
+    return size;
+  }
+
+  uint32_t dstIdx = 0;
+  uint32_t srcIdx = 0;
+  for (uint32_t i = 0; i < drawnLayersCount; ++i) {
+    const StaticLayer &layer = *drawnLayers[i];
+    for (; srcIdx < layer.startIdx; ++srcIdx, ++dstIdx) {
+      if (dstIdx != srcIdx) {
+        widgets.copyRow(dstIdx, srcIdx);
+      }
+    }
+
+    DrawParams layerParams;
+    layerParams.pos = Points::ZERO;
+    layerParams.frameRect = Rectangle(0, 0, layer.width, layer.height);
+    layerParams.widgetType = WidgetType::SPRITE_BUFFER;
+    widgets.setDrawParams(dstIdx, layerParams);
+    widgets.texture[dstIdx] = layer.texture;
+
+    ++dstIdx;
+    srcIdx += layer.widgetsCount;
+  }
+
+  for (; srcIdx < size; ++srcIdx, ++dstIdx) {
+    widgets.copyRow(dstIdx, srcIdx);
+  }
+
+  return dstIdx;
+}
+
+void StaticLayerCache::resize(const uint32_t size) {
+  _rowHashes.resize(size, 0);
+  _unchangedFrames.resize(size, 0);
+  _isRejected.resize(size, 0);
+}
+
+bool StaticLayerCache::isRowCacheable(const FrameWidgets &widgets,
+                                      const uint32_t idx) const {
+  return (WidgetType::IMAGE == widgets.widgetType[idx]) &&
+         (nullptr != widgets.texture[idx]) &&
+         (_unchangedFrames[idx] >= _stableFrames) &&
+         !_isRejected[idx];
+}
+
+bool StaticLayerCache::hasSupportedBlending(const FrameWidgets &widgets,
+                                            const uint32_t idx) const {
+  SDL_Texture *texture = widgets.texture[idx];
+  SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+  if (EXIT_SUCCESS != SDL_GetTextureBlendMode(texture, &blendMode)) {
+    return false;
+  }
+
+  if (SDL_BLENDMODE_BLEND == blendMode) {
+    return true;
+  }
+
+  if (SDL_BLENDMODE_NONE != blendMode) {
+    return false;
+  }
+
+  // without blending the alpha channel is copied into the FBO as well,
+  // which is correct only for opaque textures
+  uint32_t format = 0;
+  if (EXIT_SUCCESS != SDL_QueryTexture(texture, &format, nullptr, nullptr,
+                                       nullptr)) {
+    return false;
+  }
+
+  return (FULL_OPACITY == widgets.opacity[idx]) &&
+         !SDL_ISPIXELFORMAT_ALPHA(format);
+}
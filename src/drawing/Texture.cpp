@@ -17,6 +17,8 @@ SDL_Renderer *Texture::_renderer = nullptr;
 
 Rectangle Texture::_monitorRect;
 
+RenderStateCache Texture::_stateCache;
+
 void Texture::freeSurface(SDL_Surface *&surface) {
   if (surface) { // sanity check
     SDL_FreeSurface(surface);
@@ -26,6 +28,7 @@ void Texture::freeSurface(SDL_Surface *&surface) {
 
 void Texture::freeTexture(SDL_Texture *&texture) {
   if (texture) { // sanity check
+    _stateCache.forgetTexture(texture);
     SDL_DestroyTexture(texture);
     texture = nullptr;
   }
@@ -35,6 +38,7 @@ void Texture::setMonitorRect(const Rectangle &monitorRect) {
   //the X and Y should remain 0
   _monitorRect.w = monitorRect.w;
   _monitorRect.h = monitorRect.h;
+  _stateCache.setDefaultClipRect(_monitorRect);
 }
 
 ErrorCode Texture::getTextDimensions(const char *text, TTF_Font *font,
@@ -257,50 +261,15 @@ ErrorCode Texture::takeScreenshot(
 }
 
 ErrorCode Texture::clearCurrentRendererTarget(const Color &clearColor) {
-  Color currRendererColor = Colors::BLACK;
-  bool isSameColorAsOld = true;
-
-  // remember old renderer color
-  if (EXIT_SUCCESS != SDL_GetRenderDrawColor(_renderer,
-          &currRendererColor.rgba.r, &currRendererColor.rgba.g,
-          &currRendererColor.rgba.b, &currRendererColor.rgba.a)) {
-    LOGERR("Error in, SDL_GetRenderDrawColor(), SDL Error: %s", SDL_GetError());
+  // every clear sets it's own color, so the old one is not restored
+  if (ErrorCode::SUCCESS != _stateCache.setDrawColor(clearColor)) {
     return ErrorCode::FAILURE;
   }
 
-  if (currRendererColor != clearColor) {
-    isSameColorAsOld = false;
-  }
-
-  if (isSameColorAsOld) {
-    // clear target
-    if (EXIT_SUCCESS != SDL_RenderClear(_renderer)) {
-      LOGERR("Error in, SDL_RenderClear(), SDL Error: %s", SDL_GetError());
-      return ErrorCode::FAILURE;
-    }
-  } else { // color should be changed temporary
-    // set new renderer color
-    if (EXIT_SUCCESS != SDL_SetRenderDrawColor(_renderer, clearColor.rgba.r,
-            clearColor.rgba.g, clearColor.rgba.b, clearColor.rgba.a)) {
-      LOGERR("Error in, SDL_SetRenderDrawColor(), SDL Error: %s",
-          SDL_GetError());
-      return ErrorCode::FAILURE;
-    }
-
-    // clear target
-    if (EXIT_SUCCESS != SDL_RenderClear(_renderer)) {
-      LOGERR("Error in, SDL_RenderClear(), SDL Error: %s", SDL_GetError());
-      return ErrorCode::FAILURE;
-    }
-
-    // restore old renderer color
-    if (EXIT_SUCCESS != SDL_SetRenderDrawColor(_renderer,
-            currRendererColor.rgba.r, currRendererColor.rgba.g,
-            currRendererColor.rgba.b, currRendererColor.rgba.a)) {
-      LOGERR("Error in, SDL_SetRenderDrawColor(), SDL Error: %s",
-          SDL_GetError());
-      return ErrorCode::FAILURE;
-    }
+  // clear target
+  if (EXIT_SUCCESS != SDL_RenderClear(_renderer)) {
+    LOGERR("Error in, SDL_RenderClear(), SDL Error: %s", SDL_GetError());
+    return ErrorCode::FAILURE;
   }
 
   return ErrorCode::SUCCESS;
@@ -313,13 +282,7 @@ ErrorCode Texture::setRendererTarget(SDL_Texture *target) {
     return ErrorCode::FAILURE;
   }
 
-  if (EXIT_SUCCESS != SDL_SetRenderTarget(_renderer, target)) {
-    LOGERR("Error, default renderer target could not be set. "
-           "SDL_SetRenderTarget() failed, SDL Error: %s", SDL_GetError());
-    return ErrorCode::FAILURE;
-  }
-
-  return ErrorCode::SUCCESS;
+  return _stateCache.setRenderTarget(target);
 }
 
 void Texture::draw(SDL_Texture *texture, const DrawParams &drawParams) {
@@ -344,26 +307,14 @@ void Texture::draw(SDL_Texture *texture, const DrawParams &drawParams) {
         return;
       }
 
+      // the crop rectangle is used as a renderer clip rectangle
       if (drawParams.scaledWidth > drawParams.frameCropRect.w) {
-        if (EXIT_SUCCESS != SDL_RenderSetClipRect(_renderer, &renderQuad)) {
-          LOGERR("Error in SDL_RenderSetClipRect, SDL Error: %s",
-              SDL_GetError());
-          return;
-        }
         rendererClipped = true;
         renderQuad.w = drawParams.scaledWidth;
       }
 
       if (drawParams.scaledHeight > drawParams.frameCropRect.h) {
-        if (!rendererClipped) {
-          if (EXIT_SUCCESS != SDL_RenderSetClipRect(_renderer, &renderQuad)) {
-            LOGERR("Error in SDL_RenderSetClipRect, SDL Error: %s",
-                SDL_GetError());
-            return;
-          }
-          rendererClipped = true;
-        }
-
+        rendererClipped = true;
         renderQuad.h = drawParams.scaledHeight;
       }
     }
@@ -380,6 +331,16 @@ void Texture::draw(SDL_Texture *texture, const DrawParams &drawParams) {
     return;
   }
 
+  /** The clip rectangle of the previous cropped draw is reset lazily,
+   *  so consecutive draws with the same crop do not touch it at all
+   * */
+  const ErrorCode clipErr = rendererClipped ?
+      _stateCache.setCropClipRect(drawParams.frameCropRect) :
+      _stateCache.resetClipRect();
+  if (ErrorCode::SUCCESS != clipErr) {
+    return;
+  }
+
   // Render to screen
   if (EXIT_SUCCESS != SDL_RenderCopyEx(_renderer, // the hardware renderer
           texture,           // source texture
@@ -392,25 +353,29 @@ void Texture::draw(SDL_Texture *texture, const DrawParams &drawParams) {
            PRIu64, SDL_GetError(), drawParams.rsrcId);
     return;
   }
+}
 
-  // if clipping was done on the Hardware renderer -> reset it to default
-  // monitor rectangle
-  if (rendererClipped) {
-    if (EXIT_SUCCESS != SDL_RenderSetClipRect(_renderer,
-            reinterpret_cast<const SDL_Rect*>(&_monitorRect))) {
-      LOGERR("Error in SDL_RenderSetClipRect(), SDL Error: %s", SDL_GetError());
-
-      return;
-    }
+void Texture::resetClipRect() {
+  if (ErrorCode::SUCCESS != _stateCache.resetClipRect()) {
+    LOGERR("Error, renderer clip rectangle could not be reset");
   }
 }
 
+uint32_t Texture::getAvoidedStateChangesCount() {
+  return _stateCache.getAvoidedCallsCount();
+}
+
+void Texture::resetAvoidedStateChangesCount() {
+  _stateCache.resetAvoidedCallsCount();
+}
+
 void Texture::setRenderer(SDL_Renderer *renderer) {
   _renderer = renderer;
+  _stateCache.reset(renderer);
 }
 
 void Texture::setAlpha(SDL_Texture *texture, const int32_t alpha) {
-  if (EXIT_SUCCESS != SDL_SetTextureAlphaMod(texture,
+  if (ErrorCode::SUCCESS != _stateCache.setTextureAlphaMod(texture,
           static_cast<uint8_t>(alpha))) {
     LOGERR("Warning, .setAlpha() method will not take effect. Reason: invalid "
            "texture or alpha modulation is not supported. "
@@ -421,8 +386,8 @@ void Texture::setAlpha(SDL_Texture *texture, const int32_t alpha) {
 
 ErrorCode Texture::setBlendMode(SDL_Texture *texture,
                                 const BlendMode blendMode) {
-  if (EXIT_SUCCESS != SDL_SetTextureBlendMode(texture,
-          static_cast<SDL_BlendMode>(blendMode))) {
+  if (ErrorCode::SUCCESS !=
+      _stateCache.setTextureBlendMode(texture, blendMode)) {
     LOGERR("Warning, .setBlendMode() method will not take effect. Reason: "
            "invalid texture or blend mode is not supported. "
            "SDL_SetTextureBlendMode() failed. SDL Error: %s", SDL_GetError());
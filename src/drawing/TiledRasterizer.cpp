@@ -0,0 +1,366 @@
+// Corresponding header
+#include "sdl_utils/drawing/TiledRasterizer.h"
+
+// System headers
+#include <algorithm>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/FrameWidgets.h"
+
+namespace {
+constexpr uint32_t ALPHA_MASK = 0xFF000000u;
+
+// round(x * y / 255) for x, y in [0, 255]
+inline uint32_t mul255(const uint32_t x, const uint32_t y) {
+  const uint32_t t = (x * y) + 128;
+  return (t + (t >> 8)) >> 8;
+}
+
+inline uint32_t blendPixel(const uint32_t src, const uint32_t dst,
+                           const uint32_t alphaMod) {
+  const uint32_t alpha = mul255(src >> 24, alphaMod);
+  const uint32_t invAlpha = 255 - alpha;
+
+  uint32_t result = 0;
+  for (uint32_t shift = 0; shift < 24; shift += 8) {
+    const uint32_t channel = mul255((src >> shift) & 0xFF, alpha) +
+                             mul255((dst >> shift) & 0xFF, invAlpha);
+    result |= channel << shift;
+  }
+
+  // the source alpha channel is blended as fully opaque
+  const uint32_t dstAlpha = alpha + mul255(dst >> 24, invAlpha);
+  return result | (dstAlpha << 24);
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+// round(x * y / 255) for 16 bit lanes with x, y in [0, 255]
+inline __m128i mul255Epi16(const __m128i x, const __m128i y) {
+  const __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// blends 4 pixels with the same math as blendPixel()
+inline __m128i blendPixels4(const __m128i src, const __m128i dst,
+                            const __m128i alphaMod) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i full = _mm_set1_epi16(255);
+
+  // per pixel alpha in the low 16 bits of each 32 bit lane
+  const __m128i alpha32 = mul255Epi16(_mm_srli_epi32(src, 24), alphaMod);
+  const __m128i alphaPair =
+      _mm_or_si128(alpha32, _mm_slli_epi32(alpha32, 16));
+  const __m128i alphaLo = _mm_unpacklo_epi32(alphaPair, alphaPair);
+  const __m128i alphaHi = _mm_unpackhi_epi32(alphaPair, alphaPair);
+
+  const __m128i opaqueSrc =
+      _mm_or_si128(src, _mm_set1_epi32(static_cast<int32_t>(ALPHA_MASK)));
+
+  const __m128i lo = _mm_add_epi16(
+      mul255Epi16(_mm_unpacklo_epi8(opaqueSrc, zero), alphaLo),
+      mul255Epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(full, alphaLo)));
+  const __m128i hi = _mm_add_epi16(
+      mul255Epi16(_mm_unpackhi_epi8(opaqueSrc, zero), alphaHi),
+      mul255Epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(full, alphaHi)));
+
+  return _mm_packus_epi16(lo, hi);
+}
+#endif
+
+void blendSpan(uint32_t *dst, const uint32_t *src, const int32_t count,
+               const uint8_t alphaMod) {
+  int32_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+  const __m128i alphaModVec = _mm_set1_epi32(alphaMod);
+  for (; i + 4 <= count; i += 4) {
+    const __m128i srcVec =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i dstVec =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     blendPixels4(srcVec, dstVec, alphaModVec));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    dst[i] = blendPixel(src[i], dst[i], alphaMod);
+  }
+}
+
+void copySpan(uint32_t *dst, const uint32_t *src, const int32_t count,
+              const uint8_t alphaMod) {
+  if (FULL_OPACITY == alphaMod) {
+    memcpy(dst, src, sizeof(uint32_t) * static_cast<size_t>(count));
+    return;
+  }
+
+  for (int32_t i = 0; i < count; ++i) {
+    const uint32_t alpha = mul255(src[i] >> 24, alphaMod);
+    dst[i] = (src[i] & ~ALPHA_MASK) | (alpha << 24);
+  }
+}
+
+/** @brief maps a destination offset inside the quad to a source offset
+ *         (nearest neighbour, sampled at the destination pixel center)
+ * */
+inline int32_t mapToSource(const int32_t dstOffset, const int32_t dstSize,
+                           const int32_t srcSize, const bool isFlipped) {
+  const int32_t offset = isFlipped ? (dstSize - 1 - dstOffset) : dstOffset;
+  return static_cast<int32_t>(
+      ((2 * static_cast<int64_t>(offset) + 1) * srcSize) /
+      (2 * static_cast<int64_t>(dstSize)));
+}
+}
+
+TiledRasterizer::~TiledRasterizer() {
+  deinit();
+}
+
+ErrorCode TiledRasterizer::init(const uint32_t threadsCount,
+                                const int32_t tileSize) {
+  if (0 >= tileSize) {
+    LOGERR("Error, invalid tileSize: %d", tileSize);
+    return ErrorCode::FAILURE;
+  }
+  _tileSize = tileSize;
+
+  uint32_t totalThreads = threadsCount;
+  if (0 == totalThreads) {
+    totalThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  _isShutdown = false;
+  _workers.reserve(totalThreads - 1);
+  for (uint32_t i = 1; i < totalThreads; ++i) {
+    _workers.emplace_back(&TiledRasterizer::workerLoop, this);
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void TiledRasterizer::deinit() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isShutdown = true;
+  }
+  _startCv.notify_all();
+
+  for (std::thread &worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+}
+
+bool TiledRasterizer::isWidgetSupported(const FrameWidgets &widgets,
+                                        const uint32_t idx,
+                                        const RasterSource &source) {
+  if (FrameWidgets::IS_ROTATED & widgets.flags[idx]) {
+    return false;
+  }
+
+  if ((nullptr == source.pixels) || ((BlendMode::NONE != source.blendMode) &&
+                                     (BlendMode::BLEND != source.blendMode))) {
+    return false;
+  }
+
+  // SDL clips the source rectangle against the texture and
+  // rescales the quad accordingly. Such draws are not reproduced
+  const Rectangle &srcRect = widgets.srcRect[idx];
+  return (0 < srcRect.w) && (0 < srcRect.h) &&
+         (0 <= srcRect.x) && (0 <= srcRect.y) &&
+         (srcRect.x + srcRect.w <= source.width) &&
+         (srcRect.y + srcRect.h <= source.height);
+}
+
+void TiledRasterizer::rasterize(const FrameWidgets &widgets,
+                                const uint32_t size,
+                                const RasterSource *sources,
+                                const uint32_t clearColor,
+                                const RasterSurface &target) {
+  _sources = sources;
+  _target = target;
+  _clearColor = clearColor;
+
+  binWidgets(widgets, size);
+
+  _nextTile.store(0, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_frameGeneration;
+    _busyWorkers = static_cast<uint32_t>(_workers.size());
+  }
+  _startCv.notify_all();
+
+  // the calling thread participates as well
+  rasterizeTiles(_scratchRow);
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _doneCv.wait(lock, [this]() { return 0 == _busyWorkers; });
+}
+
+void TiledRasterizer::binWidgets(const FrameWidgets &widgets,
+                                 const uint32_t size) {
+  _tilesX = (_target.width + _tileSize - 1) / _tileSize;
+  _tilesY = (_target.height + _tileSize - 1) / _tileSize;
+
+  const size_t tilesCount = static_cast<size_t>(_tilesX) * _tilesY;
+  if (tilesCount > _tileWidgets.size()) {
+    _tileWidgets.resize(tilesCount);
+  }
+  for (size_t i = 0; i < tilesCount; ++i) {
+    _tileWidgets[i].clear();
+  }
+
+  if (size > _spans.size()) {
+    _spans.resize(size);
+  }
+
+  for (uint32_t i = 0; i < size; ++i) {
+    // widgets without a texture are not drawn
+    if ((nullptr == _sources[i].pixels) ||
+        (0 >= widgets.width[i]) || (0 >= widgets.height[i])) {
+      continue;
+    }
+
+    WidgetSpan &span = _spans[i];
+    span.minX = std::max(widgets.x[i], 0);
+    span.minY = std::max(widgets.y[i], 0);
+    span.maxX = std::min(widgets.x[i] + widgets.visibleWidth[i],
+                         _target.width);
+    span.maxY = std::min(widgets.y[i] + widgets.visibleHeight[i],
+                         _target.height);
+    if ((span.minX >= span.maxX) || (span.minY >= span.maxY)) {
+      continue;
+    }
+
+    span.quadX = widgets.x[i];
+    span.quadY = widgets.y[i];
+    span.quadW = widgets.width[i];
+    span.quadH = widgets.height[i];
+
+    const Rectangle &srcRect = widgets.srcRect[i];
+    span.srcX = srcRect.x;
+    span.srcY = srcRect.y;
+    span.srcW = srcRect.w;
+    span.srcH = srcRect.h;
+
+    // WidgetFlipType is passed to SDL as SDL_RendererFlip
+    const uint8_t flip = static_cast<uint8_t>(widgets.flipType[i]);
+    span.isFlippedX = (flip & 1);
+    span.isFlippedY = (flip & 2);
+
+    const int32_t firstTileX = span.minX / _tileSize;
+    const int32_t lastTileX = (span.maxX - 1) / _tileSize;
+    const int32_t firstTileY = span.minY / _tileSize;
+    const int32_t lastTileY = (span.maxY - 1) / _tileSize;
+    for (int32_t tileY = firstTileY; tileY <= lastTileY; ++tileY) {
+      for (int32_t tileX = firstTileX; tileX <= lastTileX; ++tileX) {
+        _tileWidgets[(tileY * _tilesX) + tileX].push_back(i);
+      }
+    }
+  }
+}
+
+void TiledRasterizer::workerLoop() {
+  std::vector<uint32_t> scratchRow;
+  uint64_t processedGeneration = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _startCv.wait(lock, [this, processedGeneration]() {
+        return _isShutdown || (processedGeneration != _frameGeneration);
+      });
+
+      if (_isShutdown) {
+        return;
+      }
+      processedGeneration = _frameGeneration;
+    }
+
+    rasterizeTiles(scratchRow);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      --_busyWorkers;
+    }
+    _doneCv.notify_one();
+  }
+}
+
+void TiledRasterizer::rasterizeTiles(std::vector<uint32_t> &scratchRow) {
+  if (static_cast<int32_t>(scratchRow.size()) < _tileSize) {
+    scratchRow.resize(static_cast<size_t>(_tileSize));
+  }
+
+  const uint32_t tilesCount = static_cast<uint32_t>(_tilesX * _tilesY);
+  while (true) {
+    const uint32_t tileIdx =
+        _nextTile.fetch_add(1, std::memory_order_relaxed);
+    if (tileIdx >= tilesCount) {
+      return;
+    }
+
+    rasterizeTile(tileIdx, scratchRow);
+  }
+}
+
+void TiledRasterizer::rasterizeTile(const uint32_t tileIdx,
+                                    std::vector<uint32_t> &scratchRow) const {
+  const int32_t tileMinX = static_cast<int32_t>(tileIdx % _tilesX) * _tileSize;
+  const int32_t tileMinY = static_cast<int32_t>(tileIdx / _tilesX) * _tileSize;
+  const int32_t tileMaxX = std::min(tileMinX + _tileSize, _target.width);
+  const int32_t tileMaxY = std::min(tileMinY + _tileSize, _target.height);
+
+  for (int32_t row = tileMinY; row < tileMaxY; ++row) {
+    uint32_t *dst = _target.pixels + (static_cast<size_t>(row) * _target.pitch);
+    std::fill(dst + tileMinX, dst + tileMaxX, _clearColor);
+  }
+
+  for (const uint32_t widgetIdx : _tileWidgets[tileIdx]) {
+    const WidgetSpan &span = _spans[widgetIdx];
+    const RasterSource &source = _sources[widgetIdx];
+
+    const int32_t minX = std::max(span.minX, tileMinX);
+    const int32_t maxX = std::min(span.maxX, tileMaxX);
+    const int32_t minY = std::max(span.minY, tileMinY);
+    const int32_t maxY = std::min(span.maxY, tileMaxY);
+    const int32_t count = maxX - minX;
+
+    // source pixels of a row are contiguous without scaling and flip
+    const bool isDirectRow = (span.quadW == span.srcW) && !span.isFlippedX;
+
+    for (int32_t row = minY; row < maxY; ++row) {
+      const int32_t srcRow = span.srcY + mapToSource(row - span.quadY,
+          span.quadH, span.srcH, span.isFlippedY);
+      const uint32_t *srcPixels =
+          source.pixels + (static_cast<size_t>(srcRow) * source.pitch);
+
+      const uint32_t *src = nullptr;
+      if (isDirectRow) {
+        src = srcPixels + span.srcX + (minX - span.quadX);
+      } else {
+        for (int32_t col = minX; col < maxX; ++col) {
+          scratchRow[col - minX] = srcPixels[span.srcX + mapToSource(
+              col - span.quadX, span.quadW, span.srcW, span.isFlippedX)];
+        }
+        src = scratchRow.data();
+      }
+
+      uint32_t *dst =
+          _target.pixels + (static_cast<size_t>(row) * _target.pitch) + minX;
+      if (BlendMode::BLEND == source.blendMode) {
+        blendSpan(dst, src, count, source.alphaMod);
+      } else {
+        copySpan(dst, src, count, source.alphaMod);
+      }
+    }
+  }
+}
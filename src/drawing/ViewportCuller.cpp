@@ -0,0 +1,164 @@
+// Corresponding header
+#include "sdl_utils/drawing/ViewportCuller.h"
+
+// System headers
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "sdl_utils/drawing/FrameWidgets.h"
+
+ErrorCode ViewportCuller::init(const uint32_t maxWidgets) {
+  if (0 == maxWidgets) {
+    LOGERR("Error, maxWidgets can not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  resize(maxWidgets);
+  return ErrorCode::SUCCESS;
+}
+
+uint32_t ViewportCuller::cull(FrameWidgets &widgets, const uint32_t size,
+                              const Rectangle &viewport) {
+  // the frame could be bigger than the initial capacity
+  // (for example FBO updates)
+  if (size > _isVisible.size()) {
+    resize(size);
+  }
+
+  // the visible quads are read straight from the hot columns
+  const int32_t *x = widgets.x.data();
+  const int32_t *y = widgets.y.data();
+  const int32_t *visibleWidth = widgets.visibleWidth.data();
+  const int32_t *visibleHeight = widgets.visibleHeight.data();
+  for (uint32_t i = 0; i < size; ++i) {
+    _minX[i] = x[i];
+    _minY[i] = y[i];
+    _maxX[i] = x[i] + visibleWidth[i];
+    _maxY[i] = y[i] + visibleHeight[i];
+  }
+
+  // rotated widgets cover a bigger area than their quad
+  const uint8_t *flags = widgets.flags.data();
+  for (uint32_t i = 0; i < size; ++i) {
+    if (!(FrameWidgets::IS_ROTATED & flags[i])) {
+      continue;
+    }
+
+    const Rectangle boundary = widgets.getDrawBoundary(i);
+    _minX[i] = boundary.x;
+    _minY[i] = boundary.y;
+    _maxX[i] = boundary.x + boundary.w;
+    _maxY[i] = boundary.y + boundary.h;
+  }
+
+  evaluateVisibility(size, viewport);
+
+  // stable compaction of the visible widgets
+  uint32_t visibleCount = 0;
+  for (uint32_t i = 0; i < size; ++i) {
+    if (!_isVisible[i]) {
+      continue;
+    }
+
+    if (visibleCount != i) {
+      widgets.copyRow(visibleCount, i);
+    }
+    ++visibleCount;
+  }
+
+  return visibleCount;
+}
+
+void ViewportCuller::resize(const uint32_t size) {
+  _minX.resize(size);
+  _minY.resize(size);
+  _maxX.resize(size);
+  _maxY.resize(size);
+  _isVisible.resize(size);
+}
+
+void ViewportCuller::evaluateVisibility(const uint32_t size,
+                                        const Rectangle &viewport) {
+  const int32_t viewMinX = viewport.x;
+  const int32_t viewMinY = viewport.y;
+  const int32_t viewMaxX = viewport.x + viewport.w;
+  const int32_t viewMaxY = viewport.y + viewport.h;
+
+  /** A widget is visible when:
+   *    minX < viewMaxX && maxX > viewMinX &&
+   *    minY < viewMaxY && maxY > viewMinY &&
+   *    minX < maxX     && minY < maxY (non-empty boundary)
+   * */
+  uint32_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i vMinX = _mm256_set1_epi32(viewMinX);
+  const __m256i vMinY = _mm256_set1_epi32(viewMinY);
+  const __m256i vMaxX = _mm256_set1_epi32(viewMaxX);
+  const __m256i vMaxY = _mm256_set1_epi32(viewMaxY);
+
+  for (; i + 8 <= size; i += 8) {
+    const __m256i minX =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_minX[i]));
+    const __m256i minY =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_minY[i]));
+    const __m256i maxX =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_maxX[i]));
+    const __m256i maxY =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_maxY[i]));
+
+    __m256i mask = _mm256_and_si256(_mm256_cmpgt_epi32(vMaxX, minX),
+                                    _mm256_cmpgt_epi32(maxX, vMinX));
+    mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(vMaxY, minY));
+    mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(maxY, vMinY));
+    mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(maxX, minX));
+    mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(maxY, minY));
+
+    const int32_t bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+    for (uint32_t lane = 0; lane < 8; ++lane) {
+      _isVisible[i + lane] = static_cast<uint8_t>((bits >> lane) & 1);
+    }
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  const __m128i vMinX = _mm_set1_epi32(viewMinX);
+  const __m128i vMinY = _mm_set1_epi32(viewMinY);
+  const __m128i vMaxX = _mm_set1_epi32(viewMaxX);
+  const __m128i vMaxY = _mm_set1_epi32(viewMaxY);
+
+  for (; i + 4 <= size; i += 4) {
+    const __m128i minX =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_minX[i]));
+    const __m128i minY =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_minY[i]));
+    const __m128i maxX =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_maxX[i]));
+    const __m128i maxY =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&_maxY[i]));
+
+    __m128i mask = _mm_and_si128(_mm_cmplt_epi32(minX, vMaxX),
+                                 _mm_cmpgt_epi32(maxX, vMinX));
+    mask = _mm_and_si128(mask, _mm_cmplt_epi32(minY, vMaxY));
+    mask = _mm_and_si128(mask, _mm_cmpgt_epi32(maxY, vMinY));
+    mask = _mm_and_si128(mask, _mm_cmplt_epi32(minX, maxX));
+    mask = _mm_and_si128(mask, _mm_cmplt_epi32(minY, maxY));
+
+    const int32_t bits = _mm_movemask_ps(_mm_castsi128_ps(mask));
+    for (uint32_t lane = 0; lane < 4; ++lane) {
+      _isVisible[i + lane] = static_cast<uint8_t>((bits >> lane) & 1);
+    }
+  }
+#endif /* defined(__AVX2__) */
+
+  // scalar fallback and tail
+  for (; i < size; ++i) {
+    _isVisible[i] = static_cast<uint8_t>(
+        (_minX[i] < viewMaxX) && (_maxX[i] > viewMinX) &&
+        (_minY[i] < viewMaxY) && (_maxY[i] > viewMinY) &&
+        (_minX[i] < _maxX[i]) && (_minY[i] < _maxY[i]));
+  }
+}
@@ -9,6 +9,32 @@
 
 //Own components headers
 
+namespace {
+constexpr const char* RENDERER_CMD_NAMES[RENDERER_CMDS_COUNT] {
+  "CLEAR_SCREEN",
+  "FINISH_FRAME",
+  "CHANGE_CLEAR_COLOR",
+  "LOAD_TEXTURE_SINGLE",
+  "LOAD_TEXTURE_MULTIPLE",
+  "DESTROY_TEXTURE",
+  "CREATE_FBO",
+  "DESTROY_FBO",
+  "CHANGE_RENDERER_TARGET",
+  "RESET_RENDERER_TARGET",
+  "CLEAR_RENDERER_TARGET",
+  "UPDATE_RENDERER_TARGET",
+  "UPDATE_RENDERER_TARGET_PACKED",
+  "CHANGE_TEXTURE_BLENDMODE",
+  "CHANGE_TEXTURE_OPACITY",
+  "CREATE_TTF_TEXT",
+  "RELOAD_TTF_TEXT",
+  "DESTROY_TTF_TEXT",
+  "ENABLE_DISABLE_MULTITHREAD_TEXTURE_LOADING",
+  "TAKE_SCREENSHOT",
+  "EXIT_RENDERING_LOOP"
+};
+}
+
 RendererFlagsMask valiteRendererFlagsMask(const RendererFlagsMask mask) {
   constexpr auto maxRendererFlagsMaskValue =
       getEnumValue(RendererFlag::SOFTARE_RENDERER) |
@@ -56,3 +82,12 @@ std::string getRendererPolicyName(RendererPolicy policy) {
     return "UNSUPPORTED_RENDERER_POLICY";
   }
 }
+
+const char* getRendererCmdName(const RendererCmd cmd) {
+  const auto cmdIdx = getEnumValue(cmd);
+  if (RENDERER_CMDS_COUNT <= cmdIdx) {
+    return "UNDEFINED";
+  }
+
+  return RENDERER_CMD_NAMES[cmdIdx];
+}
@@ -0,0 +1,249 @@
+// System headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include <SDL_hints.h>
+#include "utils/data_type/EnumClassUtils.h"
+
+// Own components headers
+#include "sdl_utils/containers/SDLContainers.h"
+#include "sdl_utils/drawing/config/RendererConfig.h"
+#include "sdl_utils/drawing/FrameCaptureReader.h"
+#include "sdl_utils/drawing/MonitorWindow.h"
+#include "sdl_utils/drawing/Renderer.h"
+#include "sdl_utils/SDLLoader.h"
+
+/* Re-executes a frame capture (see Renderer::startFrameCapture_UT())
+ * against a Renderer, created with the SDL dummy video driver and the
+ * software renderer. No application and no display are needed, so
+ * identical input could be used to A/B renderer changes.
+ * */
+
+namespace {
+struct ReplayConfig {
+  std::string captureFile;
+  std::string resourcesFolder;
+  uint32_t loops = 1;
+  int32_t maxRuntimeTexts = 1000;
+  int32_t maxRuntimeSpriteBuffers = 100;
+  DrawBackend drawBackend = DrawBackend::RENDER_COPY;
+  bool enableViewportCulling = false;
+  bool enableDrawReordering = false;
+};
+
+class ReplayContainers : public SDLContainers {
+ public:
+  using SDLContainers::SDLContainers;
+
+  void onLoadTextureMultipleCompleted(
+      [[maybe_unused]]const int32_t batchId) override {
+  }
+};
+
+constexpr int32_t DEFAULT_WINDOW_WIDTH = 1920;
+constexpr int32_t DEFAULT_WINDOW_HEIGHT = 1080;
+
+void printUsage(const char *binaryName) {
+  std::cerr << "Usage: " << binaryName << " --capture <file>"
+            << " --resources <folder> [--loops <count>]"
+            << " [--texts <count>] [--sprite-buffers <count>]"
+            << " [--batched-geometry] [--viewport-culling]"
+            << " [--draw-reordering]\n"
+            << "NOTE: replay loops > 1 only for captures, which do not "
+            << "create resources\n";
+}
+
+bool parseArgs(int argc, char *argv[], ReplayConfig &outCfg) {
+  for (int i = 1; i < argc; ++i) {
+    const bool hasValue = (i + 1 < argc);
+    if ((0 == std::strcmp(argv[i], "--capture")) && hasValue) {
+      outCfg.captureFile = argv[++i];
+    } else if ((0 == std::strcmp(argv[i], "--resources")) && hasValue) {
+      outCfg.resourcesFolder = argv[++i];
+    } else if ((0 == std::strcmp(argv[i], "--loops")) && hasValue) {
+      outCfg.loops =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if ((0 == std::strcmp(argv[i], "--texts")) && hasValue) {
+      outCfg.maxRuntimeTexts = std::atoi(argv[++i]);
+    } else if ((0 == std::strcmp(argv[i], "--sprite-buffers")) && hasValue) {
+      outCfg.maxRuntimeSpriteBuffers = std::atoi(argv[++i]);
+    } else if (0 == std::strcmp(argv[i], "--batched-geometry")) {
+      outCfg.drawBackend = DrawBackend::BATCHED_GEOMETRY;
+    } else if (0 == std::strcmp(argv[i], "--viewport-culling")) {
+      outCfg.enableViewportCulling = true;
+    } else if (0 == std::strcmp(argv[i], "--draw-reordering")) {
+      outCfg.enableDrawReordering = true;
+    } else {
+      return false;
+    }
+  }
+
+  return !outCfg.captureFile.empty() && (0 < outCfg.loops);
+}
+
+ErrorCode initSdl() {
+  // headless execution
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+
+  if ((ErrorCode::SUCCESS != SDLLoader::initSdl2()) ||
+      (ErrorCode::SUCCESS != SDLLoader::initSdl2Image()) ||
+      (ErrorCode::SUCCESS != SDLLoader::initSdl2Ttf()) ||
+      (ErrorCode::SUCCESS != SDLLoader::initSdl2Mixer())) {
+    std::cerr << "Error, SDL initialisation failed" << std::endl;
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void deinitSdl() {
+  SDLLoader::deinitSdl2Mixer();
+  SDLLoader::deinitSdl2Ttf();
+  SDLLoader::deinitSdl2Image();
+  SDLLoader::deinitSdl2();
+}
+
+uint64_t getPercentile(const std::vector<uint64_t> &sortedValues,
+                       const double percentile) {
+  if (sortedValues.empty()) {
+    return 0;
+  }
+
+  const size_t idx = static_cast<size_t>(
+      (percentile / 100.0) * static_cast<double>(sortedValues.size() - 1));
+  return sortedValues[idx];
+}
+
+int32_t replay(const ReplayConfig &cfg, FrameCaptureReader &reader) {
+  const FrameCaptureHeader &header = reader.getHeader();
+
+  MonitorWindowConfig windowCfg;
+  windowCfg.name = "frame_replay";
+  windowCfg.pos = Points::UNDEFINED;
+  windowCfg.width = (0 < header.windowWidth) ?
+      header.windowWidth : DEFAULT_WINDOW_WIDTH;
+  windowCfg.height = (0 < header.windowHeight) ?
+      header.windowHeight : DEFAULT_WINDOW_HEIGHT;
+  windowCfg.displayMode = WindowDisplayMode::WINDOWED;
+  windowCfg.borderMode = WindowBorderMode::BORDERLESS;
+
+  MonitorWindow window;
+  if (ErrorCode::SUCCESS != window.init(windowCfg)) {
+    std::cerr << "Error, window.init() failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the replay frames are executed synchronously, so they could be timed
+  RendererConfig rendererCfg;
+  rendererCfg.window = window.getNativeWindow();
+  rendererCfg.executionPolicy = RendererPolicy::SINGLE_THREADED;
+  rendererCfg.drawBackend = cfg.drawBackend;
+  rendererCfg.enableViewportCulling = cfg.enableViewportCulling;
+  rendererCfg.enableDrawReordering = cfg.enableDrawReordering;
+  rendererCfg.flagsMask = getEnumValue(RendererFlag::SOFTARE_RENDERER) |
+                          getEnumValue(RendererFlag::FBO_ENABLE);
+  rendererCfg.maxRuntimeWidgets = std::max(header.maxFrameWidgets, 1u);
+  // +1 for the shutdown command
+  rendererCfg.maxRuntimeRendererCommands = header.maxFrameRendererCmds + 1;
+  rendererCfg.maxRendererBackBufferDataSize =
+      std::max<uint64_t>(header.maxFrameDataBytes, 1);
+
+  Renderer renderer;
+  if (ErrorCode::SUCCESS != renderer.init(rendererCfg)) {
+    std::cerr << "Error, renderer.init() failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  SDLContainersConfig containersCfg;
+  containersCfg.resourcesFolderLocation = cfg.resourcesFolder;
+  containersCfg.maxRuntimeTexts = cfg.maxRuntimeTexts;
+  containersCfg.maxRuntimeSpriteBuffers = cfg.maxRuntimeSpriteBuffers;
+
+  ReplayContainers containers(containersCfg);
+  containers.setRenderer(&renderer);
+  renderer.setSDLContainers(&containers);
+  if (ErrorCode::SUCCESS != containers.init()) {
+    std::cerr << "Error, containers.init() failed" << std::endl;
+    renderer.deinit();
+    return EXIT_FAILURE;
+  }
+
+  std::vector<uint64_t> frameNs;
+  frameNs.reserve(static_cast<size_t>(header.framesCount) * cfg.loops);
+
+  CapturedFrame frame;
+  for (uint32_t loop = 0; loop < cfg.loops; ++loop) {
+    reader.rewind();
+    while (reader.readFrame(frame)) {
+      const auto start = std::chrono::steady_clock::now();
+      renderer.replayFrame_UT(frame);
+      const auto end = std::chrono::steady_clock::now();
+
+      frameNs.push_back(static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              end - start).count()));
+    }
+  }
+
+  renderer.shutdownRenderer_UT();
+  containers.deinit();
+  renderer.deinit();
+
+  uint64_t totalNs = 0;
+  for (const uint64_t ns : frameNs) {
+    totalNs += ns;
+  }
+  std::sort(frameNs.begin(), frameNs.end());
+
+  const uint64_t framesCount = frameNs.size();
+  const uint64_t meanNs = framesCount ? (totalNs / framesCount) : 0;
+  std::cout << "{\"capture\": \"" << cfg.captureFile << "\""
+            << ", \"frames\": " << framesCount
+            << ", \"widgets_peak\": " << header.maxFrameWidgets
+            << ", \"total_ns\": " << totalNs
+            << ", \"mean_ns\": " << meanNs
+            << ", \"p50_ns\": " << getPercentile(frameNs, 50.0)
+            << ", \"p99_ns\": " << getPercentile(frameNs, 99.0)
+            << ", \"max_ns\": " << (framesCount ? frameNs.back() : 0)
+            << "}" << std::endl;
+
+  if (header.framesCount * cfg.loops != framesCount) {
+    std::cerr << "Error, replayed " << framesCount << " out of "
+              << header.framesCount * cfg.loops << " frames" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+}
+
+int main(int argc, char *argv[]) {
+  ReplayConfig cfg;
+  if (!parseArgs(argc, argv, cfg)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  FrameCaptureReader reader;
+  if (ErrorCode::SUCCESS != reader.open(cfg.captureFile)) {
+    std::cerr << "Error, reader.open() failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (ErrorCode::SUCCESS != initSdl()) {
+    return EXIT_FAILURE;
+  }
+
+  const int32_t exitCode = replay(cfg, reader);
+
+  deinitSdl();
+  return exitCode;
+}